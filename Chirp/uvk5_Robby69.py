@@ -28,6 +28,7 @@
 
 import struct
 import logging
+import time
 import wx
 
 from chirp import chirp_common, directory, bitwise, memmap, errors, util
@@ -437,6 +438,8 @@ MEM_SIZE = 0x2000  # size of all memory
 PROG_SIZE = 0x1d00  # size of the memory that we will write
 MEM_BLOCK = 0x80  # largest block of memory that we can reliably write
 CAL_START = 0x1E00 # calibration memory start address
+DEFAULT_BAUD = 38400
+FAST_BAUDS = [460800, 230400, 115200]  # tried in this order after the hello
 
 # fm radio supported frequencies
 FMMIN = 76.0
@@ -502,14 +505,14 @@ def xorarr(data: bytes):
     return ret
 
 
-def calculate_crc16_xmodem(data: bytes):
+def calculate_crc16_xmodem(data: bytes, crc=0x0):
     """
     if this crc was used for communication to AND from the radio, then it
     would be a measure to increase reliability.
     but it's only used towards the radio, so it's for further obfuscation
+    pass the previous result as crc to continue over more data
     """
     poly = 0x1021
-    crc = 0x0
     for byte in data:
         crc = crc ^ (byte << 8)
         for _ in range(8):
@@ -629,7 +632,47 @@ def _readmem(serport, offset, length):
     return rep[8:]
 
 
-def _writemem(serport, data, offset):
+def _readstream(serport, offset, length, progress=None):
+    """read a range with a single request, the radio sends back-to-back
+    frames carrying a running crc. Returns None if the firmware does not
+    know the command"""
+    LOG.debug("Sending readstream offset=0x%4.4x len=0x%4.4x", offset, length)
+
+    readstream = b"\x33\x05\x08\x00" + \
+        struct.pack("<HH", offset, length) + \
+        b"\x6a\x39\x57\x64"
+    _send_command(serport, readstream)
+
+    data = b""
+    running_crc = 0x0
+    while len(data) < length:
+        try:
+            rep = _receive_reply(serport)
+        except errors.RadioError:
+            if data:
+                raise
+            LOG.info("Streamed read not supported, using block reads")
+            return None
+
+        rid, _, roffset, rsize, crc, remaining = \
+            struct.unpack("<HHHBxHH", rep[:12])
+        if rid != 0x0534 or roffset != offset + len(data):
+            raise errors.RadioError("Bad frame in streamed read")
+
+        chunk = rep[12:12+rsize]
+        data += chunk
+        running_crc = calculate_crc16_xmodem(chunk, running_crc)
+        if running_crc != crc or \
+                len(data) + remaining != length:
+            raise errors.RadioError("CRC error in streamed read")
+
+        if progress:
+            progress(offset + len(data))
+
+    return data
+
+
+def _writemem_send(serport, data, offset):
     LOG.debug("Sending writemem offset=0x%4.4x len=0x%4.4x",
               offset, len(data))
 
@@ -643,6 +686,9 @@ def _writemem(serport, data, offset):
         b"\x6a\x39\x57\x64"+data
 
     _send_command(serport, writemem)
+
+
+def _writemem_check(serport, offset):
     rep = _receive_reply(serport)
 
     LOG.debug("writemem Received data: %s len=%i", util.hexprint(rep), len(rep))
@@ -656,6 +702,56 @@ def _writemem(serport, data, offset):
     raise errors.RadioError("Bad response to writemem")
 
 
+def _writemem(serport, data, offset):
+    _writemem_send(serport, data, offset)
+    return _writemem_check(serport, offset)
+
+
+def _setbaud(serport, baud):
+    """ask the radio to change its line rate, the reply comes at the old
+    rate. Returns the rate the radio is using afterwards"""
+    setbaud = b"\x35\x05\x08\x00" + struct.pack("<I", baud) + \
+        b"\x6a\x39\x57\x64"
+    _send_command(serport, setbaud)
+    rep = _receive_reply(serport)
+    if len(rep) < 8 or rep[0] != 0x36 or rep[1] != 0x05:
+        raise errors.RadioError("Bad response to setbaud")
+    return struct.unpack("<I", rep[4:8])[0]
+
+
+def _negotiate_baud(serport):
+    """switch to the fastest rate both ends manage. The radio falls back to
+    38400 on its own if nothing valid arrives at the new rate"""
+    for baud in FAST_BAUDS:
+        try:
+            if _setbaud(serport, baud) != baud:
+                continue
+        except errors.RadioError:
+            LOG.info("Radio does not support baud rate changes")
+            return DEFAULT_BAUD
+        serport.baudrate = baud
+        try:
+            _sayhello(serport)
+            LOG.info("Running at %i baud", baud)
+            return baud
+        except errors.RadioError:
+            LOG.info("No answer at %i baud, going back to %i",
+                     baud, DEFAULT_BAUD)
+            serport.baudrate = DEFAULT_BAUD
+            time.sleep(1.2)
+            _sayhello(serport)
+    return DEFAULT_BAUD
+
+
+def _restorebaud(serport):
+    if serport.baudrate != DEFAULT_BAUD:
+        try:
+            _setbaud(serport, DEFAULT_BAUD)
+        except errors.RadioError:
+            pass
+        serport.baudrate = DEFAULT_BAUD
+
+
 def _resetradio(serport):
     resetpacket = b"\xdd\x05\x00\x00"
     _send_command(serport, resetpacket)
@@ -678,6 +774,23 @@ def do_download(radio):
     else:
         raise errors.RadioError("Failed to initialize radio")
 
+    def progress(addr):
+        status.cur = addr
+        radio.status_fn(status)
+
+    _negotiate_baud(serport)
+    try:
+        data = _readstream(serport, 0, MEM_SIZE, progress)
+    finally:
+        _restorebaud(serport)
+    if data is not None:
+        return memmap.MemoryMapBytes(data)
+
+    # older firmware, one request per block
+    f = _sayhello(serport)
+    if not f:
+        raise errors.RadioError("Failed to initialize radio")
+
     addr = 0
     while addr < MEM_SIZE:
         data = _readmem(serport, addr, MEM_BLOCK)
@@ -718,16 +831,27 @@ def do_upload(radio):
     else:
         return False
 
-    addr = start_addr
-    while addr < stop_addr:
-        dat = radio.get_mmap()[addr:addr+MEM_BLOCK]
-        _writemem(serport, dat, addr)
-        status.cur = addr - start_addr
-        radio.status_fn(status)
-        if dat:
+    _negotiate_baud(serport)
+    try:
+        # the next block is sent while the radio burns the previous one, the
+        # radio buffers one frame so there is never more than one in flight
+        pending = None
+        addr = start_addr
+        while addr < stop_addr:
+            dat = radio.get_mmap()[addr:addr+MEM_BLOCK]
+            if not dat:
+                raise errors.RadioError("Memory upload incomplete")
+            _writemem_send(serport, dat, addr)
+            if pending is not None:
+                _writemem_check(serport, pending)
+            pending = addr
+            status.cur = addr - start_addr
+            radio.status_fn(status)
             addr += MEM_BLOCK
-        else:
-            raise errors.RadioError("Memory upload incomplete")
+        if pending is not None:
+            _writemem_check(serport, pending)
+    finally:
+        _restorebaud(serport)
     status.msg = "Uploaded OK"
 
     _resetradio(serport)
@@ -414,6 +414,11 @@ void ACTION_Handle(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 		case ACTION_OPT_BLMIN_TMP_OFF:
 			ACTION_BlminTmpOff();
 			break;
+#endif
+#ifdef ENABLE_PROFILER
+		case ACTION_OPT_PROFILER:
+			gRequestDisplayScreen = DISPLAY_PROFILER;
+			break;
 #endif
 	}
 }
@@ -52,6 +52,8 @@
 #include "frequencies.h"
 #include "functions.h"
 #include "helper/battery.h"
+#include "helper/journal.h"
+#include "helper/profiler.h"
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
@@ -193,7 +195,7 @@ static void HandleIncoming(void)
 #endif
 		if (gCurrentFunction != FUNCTION_FOREGROUND) {
 			FUNCTION_Select(FUNCTION_FOREGROUND);
-			gUpdateDisplay = true;
+			UI_MAIN_Invalidate(UI_MAIN_RX_STATE);
 		}
 		return;
 	}
@@ -369,7 +371,7 @@ Skip:
 					gNOAACountdown_10ms = 300;         // 3 sec
 			#endif
 
-			gUpdateDisplay = true;
+			UI_MAIN_Invalidate(UI_MAIN_RX_STATE);
 #ifdef ENABLE_SCANNER1
 			if (gScanStateDir != SCAN_OFF)
 			{
@@ -519,7 +521,7 @@ void APP_StartListening(FUNCTION_Type_t Function)
 			GUI_SelectNextDisplay(DISPLAY_MAIN);
 	}
 	else
-		gUpdateDisplay = true;
+		UI_MAIN_Invalidate(UI_MAIN_RX_STATE);
 
 	gUpdateStatus = true;
 }
@@ -634,7 +636,7 @@ static void CheckRadioInterrupts(void)
 						gDTMF_RX_live[len++]  = c;
 						gDTMF_RX_live[len]    = 0;
 						gDTMF_RX_live_timeout = DTMF_RX_live_timeout_500ms;  // time till we delete it
-						gUpdateDisplay        = true;
+						UI_MAIN_Invalidate(UI_MAIN_CENTER);
 					}
 #endif
 
@@ -867,10 +869,14 @@ void APP_Update(void)
 
 //Robby69 auto start spectrum 
 	uint8_t Spectrum_state = 0; //Spectrum Not Active
-  	EEPROM_ReadBuffer(0x1D00, &Spectrum_state, 1);
+	JOURNAL_Read(JOURNAL_KEY_SPECTRUM, &Spectrum_state);
 	if (Spectrum_state >0 && Spectrum_state <10)
 		APP_RunSpectrum(Spectrum_state);
-	
+
+	// a remote sweep is tuning the BK4819, no scanning, NOAA, dual watch or sleep until it ends
+	if (UART_IsSweeping())
+		return;
+
 #ifdef ENABLE_VOICE
 	if (!SCANNER_IsScanning() && gScanStateDir != SCAN_OFF && gScheduleScanListen && !gPttIsPressed && gVoiceWriteIndex == 0)
 #else
@@ -1037,7 +1043,7 @@ void APP_Update(void)
 
 static void gobacktospectrum(void){
 	uint8_t Spectrum_state = 0; //Spectrum Not Active
-	EEPROM_ReadBuffer(0x1D00, &Spectrum_state, 1);
+	JOURNAL_Read(JOURNAL_KEY_SPECTRUM, &Spectrum_state);
 	if (Spectrum_state >10) //WAS SPECTRUM
 		APP_RunSpectrum(Spectrum_state-10);
 }
@@ -1192,18 +1198,17 @@ void APP_TimeSlice10ms(void)
 		keyTickCounter++;
 	#endif
 
-	if (UART_IsCommandAvailable())
-	{
-		__disable_irq();
-		UART_HandleCommand();
-		__enable_irq();
-	}
+	UART_TimeSlice10ms();
+
+	// long commands continue from the main loop, the next one waits in the DMA ring
+	for (unsigned int i = 0; i < 4 && !UART_IsBusy() && UART_IsCommandAvailable(); i++)
+		PROFILE(PROFILER_UART_COMMAND, UART_HandleCommand());
 
 	if (gReducedService)
 		return;
 
 	if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode)
-		CheckRadioInterrupts();
+		PROFILE(PROFILER_RADIO_INTERRUPTS, CheckRadioInterrupts());
 
 	if (gCurrentFunction == FUNCTION_TRANSMIT)
 	{	// transmitting
@@ -1216,8 +1221,10 @@ void APP_TimeSlice10ms(void)
 	if (gUpdateDisplay)
 	{
 		gUpdateDisplay = false;
-		GUI_DisplayScreen();
+		PROFILE(PROFILER_DISPLAY, GUI_DisplayScreen());
 	}
+	else if (gScreenToDisplay == DISPLAY_MAIN)
+		PROFILE(PROFILER_DISPLAY, UI_MAIN_Update());
 
 	if (gUpdateStatus)
 		UI_DisplayStatus();
@@ -1379,6 +1386,11 @@ void APP_TimeSlice500ms(void)
 		}
 	#endif
 
+	#ifdef ENABLE_PROFILER
+		if (gScreenToDisplay == DISPLAY_PROFILER)
+			gUpdateDisplay = true;
+	#endif
+
 	// Skipped authentic device check
 
 	if (gKeypadLocked > 0)
@@ -1411,7 +1423,7 @@ void APP_TimeSlice500ms(void)
 				if (gDTMF_RX_live[0] != 0)
 				{
 					memset(gDTMF_RX_live, 0, sizeof(gDTMF_RX_live));
-					gUpdateDisplay   = true;
+					UI_MAIN_Invalidate(UI_MAIN_CENTER);
 				}
 			}
 		}
@@ -1959,6 +1971,19 @@ static void ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 						AIRCOPY_ProcessKeys(Key, bKeyPressed, bKeyHeld);
 						break;
 				#endif
+
+				#ifdef ENABLE_PROFILER
+					case DISPLAY_PROFILER:
+						if (bKeyPressed || bKeyHeld)
+							break;
+						if (Key == KEY_EXIT)
+							gRequestDisplayScreen = DISPLAY_MAIN;
+						else if (Key == KEY_MENU)
+							PROFILER_Reset();
+						else
+							gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+						break;
+				#endif
 				case DISPLAY_INVALID:
 				default:
 					gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
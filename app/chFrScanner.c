@@ -4,6 +4,7 @@
 #include "functions.h"
 #include "misc.h"
 #include "settings.h"
+#include "ui/main.h"
 
 int8_t            gScanStateDir;
 bool              gScanKeepResult;
@@ -167,7 +168,7 @@ static void NextFreqChannel(void)
 	gScanPauseDelayIn_10ms = scan_pause_delay_in_6_10ms;
 #endif
 
-	gUpdateDisplay     = true;
+	UI_MAIN_Invalidate(UI_MAIN_VFO(gEeprom.RX_VFO, UI_MAIN_FREQUENCY | UI_MAIN_FLAGS));
 }
 
 static void NextMemChannel(void)
@@ -191,7 +192,7 @@ static void NextMemChannel(void)
 		RADIO_ConfigureChannel(gEeprom.RX_VFO, VFO_CONFIGURE_RELOAD);
 		RADIO_SetupRegisters(true);
 
-		gUpdateDisplay = true;
+		UI_MAIN_Invalidate(UI_MAIN_VFO(gEeprom.RX_VFO, UI_MAIN_PANEL));
 	}
 
 #ifdef ENABLE_FASTER_CHANNEL_SCAN
@@ -0,0 +1,189 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+
+#include "app/eventlog.h"
+#include "driver/eeprom.h"
+#include "scheduler.h"
+
+// EEPROM copy of an event, the start tick means nothing after a power cycle
+// and the channel can be looked up again from the frequency
+typedef struct {
+	uint32_t Frequency;
+	uint16_t Duration;
+	uint8_t  Rssi;        // peak / 2
+	uint8_t  Code;
+} EVENTLOG_Spill_t;
+
+static EVENTLOG_Event_t gEvents[EVENTLOG_SIZE];
+static uint8_t          gHead;      // slot of the next event
+static uint8_t          gCount;
+static bool             gActive;    // the newest event is still going on
+
+static EVENTLOG_Event_t *Newest(void)
+{
+	return &gEvents[(gHead + EVENTLOG_SIZE - 1) % EVENTLOG_SIZE];
+}
+
+static EVENTLOG_Event_t *Push(void)
+{
+	EVENTLOG_Event_t *pEvent = &gEvents[gHead];
+
+	gHead = (gHead + 1) % EVENTLOG_SIZE;
+	if (gCount < EVENTLOG_SIZE)
+		gCount++;
+
+	memset(pEvent, 0, sizeof(*pEvent));
+	pEvent->Channel = EVENTLOG_NO_CHANNEL;
+	pEvent->Code    = EVENTLOG_NO_CODE;
+	return pEvent;
+}
+
+void EVENTLOG_Start(uint32_t Frequency, uint16_t Rssi, uint8_t Channel)
+{
+	EVENTLOG_Event_t *pEvent;
+
+	if (gActive)
+		EVENTLOG_Stop();
+
+	pEvent            = Push();
+	pEvent->Start     = SCHEDULER_GetTick();
+	pEvent->Frequency = Frequency;
+	pEvent->Rssi      = Rssi;
+	pEvent->Channel   = Channel;
+
+	// tick 0 marks the events of a previous session
+	if (pEvent->Start == 0)
+		pEvent->Start = 1;
+
+	gActive = true;
+}
+
+void EVENTLOG_Update(uint16_t Rssi)
+{
+	EVENTLOG_Event_t *pEvent = Newest();
+
+	if (gActive && Rssi > pEvent->Rssi)
+		pEvent->Rssi = Rssi;
+}
+
+void EVENTLOG_SetCode(uint8_t Code)
+{
+	if (gActive)
+		Newest()->Code = Code;
+}
+
+void EVENTLOG_Stop(void)
+{
+	EVENTLOG_Event_t *pEvent = Newest();
+	uint32_t          Duration;
+
+	if (!gActive)
+		return;
+
+	Duration         = SCHEDULER_GetTick() - pEvent->Start;
+	pEvent->Duration = (Duration > 0xFFFF) ? 0xFFFF : Duration;
+	gActive          = false;
+}
+
+uint8_t EVENTLOG_Count(void)
+{
+	return gCount;
+}
+
+/*
+Index 0 is the oldest event, the duration of one still going on is up to now
+*/
+bool EVENTLOG_Get(uint8_t Index, EVENTLOG_Event_t *pEvent)
+{
+	if (Index >= gCount)
+		return false;
+
+	*pEvent = gEvents[(gHead + EVENTLOG_SIZE - gCount + Index) % EVENTLOG_SIZE];
+
+	if (gActive && Index == gCount - 1) {
+		const uint32_t Duration = SCHEDULER_GetTick() - pEvent->Start;
+		pEvent->Duration = (Duration > 0xFFFF) ? 0xFFFF : Duration;
+	}
+
+	return true;
+}
+
+void EVENTLOG_Clear(void)
+{
+	gHead   = 0;
+	gCount  = 0;
+	gActive = false;
+}
+
+/*
+Brings back the events saved when the spectrum was last left, only into an empty log
+*/
+void EVENTLOG_Load(void)
+{
+#ifdef ENABLE_SPECTRUM_EVENTLOG_SPILL
+	EVENTLOG_Spill_t Spill[EVENTLOG_SPILL_SLOTS];
+
+	if (gCount > 0)
+		return;
+
+	EEPROM_ReadBuffer(EVENTLOG_SPILL_ADDR, Spill, sizeof(Spill));
+
+	for (unsigned int i = 0; i < EVENTLOG_SPILL_SLOTS; i++)
+	{
+		EVENTLOG_Event_t *pEvent;
+
+		if (Spill[i].Frequency == 0 || Spill[i].Frequency == 0xFFFFFFFF)
+			continue;   // unused slot
+
+		pEvent            = Push();
+		pEvent->Frequency = Spill[i].Frequency;
+		pEvent->Duration  = Spill[i].Duration;
+		pEvent->Rssi      = Spill[i].Rssi * 2;
+		pEvent->Code      = Spill[i].Code;
+	}
+#endif
+}
+
+/*
+Keeps the newest events over a power cycle, pages that did not change are not rewritten
+*/
+void EVENTLOG_Save(void)
+{
+#ifdef ENABLE_SPECTRUM_EVENTLOG_SPILL
+	const uint8_t Count = (gCount < EVENTLOG_SPILL_SLOTS) ? gCount : EVENTLOG_SPILL_SLOTS;
+
+	EVENTLOG_Stop();
+
+	for (unsigned int i = 0; i < EVENTLOG_SPILL_SLOTS; i++)
+	{
+		EVENTLOG_Spill_t Spill;
+		EVENTLOG_Event_t Event;
+
+		memset(&Spill, 0xFF, sizeof(Spill));
+
+		if (i < Count && EVENTLOG_Get(gCount - Count + i, &Event)) {
+			Spill.Frequency = Event.Frequency;
+			Spill.Duration  = Event.Duration;
+			Spill.Rssi      = (Event.Rssi > 0x1FF) ? 0xFF : Event.Rssi / 2;
+			Spill.Code      = Event.Code;
+		}
+
+		EEPROM_WriteBuffer(EVENTLOG_SPILL_ADDR + (i * sizeof(Spill)), &Spill, true);
+	}
+#endif
+}
@@ -0,0 +1,55 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_EVENTLOG_H
+#define APP_EVENTLOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Signals found by the spectrum, one record per squelch opening. The newest
+// EVENTLOG_SIZE records are kept in RAM, the newest EVENTLOG_SPILL_SLOTS are
+// written to EEPROM when the spectrum is left and come back on the next start.
+
+#define EVENTLOG_SIZE        24
+#define EVENTLOG_SPILL_ADDR  0x1D48
+#define EVENTLOG_SPILL_SLOTS 8
+
+#define EVENTLOG_NO_CHANNEL  0xFF
+#define EVENTLOG_NO_CODE     0xFF
+#define EVENTLOG_CODE_DCS    0x80   // set: DCS_Options index, clear: CTCSS_Options index
+
+typedef struct {
+	uint32_t Start;       // 10ms ticks since power on, 0: from a previous session
+	uint32_t Frequency;   // 10Hz
+	uint16_t Duration;    // 10ms, saturates
+	uint16_t Rssi;        // peak
+	uint8_t  Channel;     // MR channel, EVENTLOG_NO_CHANNEL if none
+	uint8_t  Code;        // EVENTLOG_NO_CODE, CTCSS index or EVENTLOG_CODE_DCS | DCS index
+	uint8_t  Padding[2];
+} EVENTLOG_Event_t;
+
+void    EVENTLOG_Start(uint32_t Frequency, uint16_t Rssi, uint8_t Channel);
+void    EVENTLOG_Update(uint16_t Rssi);
+void    EVENTLOG_SetCode(uint8_t Code);
+void    EVENTLOG_Stop(void);
+uint8_t EVENTLOG_Count(void);
+bool    EVENTLOG_Get(uint8_t Index, EVENTLOG_Event_t *pEvent);
+void    EVENTLOG_Clear(void);
+void    EVENTLOG_Load(void);
+void    EVENTLOG_Save(void);
+
+#endif
@@ -17,6 +17,7 @@
  *     limitations under the License.
  */
 
+#include <stddef.h>
 #include <string.h>
 
 #if !defined(ENABLE_OVERLAY)
@@ -113,25 +114,130 @@ void MENU_StopCssScan(void)
 	gUpdateStatus = true;
 }
 
+// Settings that are a single byte edited in place, looked up by menu id. The
+// entry gives the range, where the value lives and what has to be redone once
+// it changed. Every listed value is one byte wide (enums are, with -fshort-enums).
+// Items with Max == 0 are not listed and have their own case in MENU_GetLimits,
+// MENU_AcceptSetting and MENU_ShowCurrentSetting.
+typedef struct {
+	uint8_t *pValue;     // NULL for a setting of the VFO being edited
+	uint8_t  VfoOffset;  // of the setting in VFO_Info_t when pValue is NULL
+	uint8_t  Apply;
+	uint8_t  Min;
+	uint8_t  Max;
+} MenuSetting_t;
+
+enum {
+	APPLY_CONFIGURE   = 1u << 0,   // gVfoConfigureMode = VFO_CONFIGURE
+	APPLY_RELOAD      = 1u << 1,   // reload and reset the VFOs
+	APPLY_RECONFIGURE = 1u << 2,   // gFlagReconfigureVfos
+	APPLY_STATUS      = 1u << 3,   // redraw the status line
+	APPLY_CALIBRATION = 1u << 4,   // BOARD_EEPROM_LoadCalibration()
+};
+
+#define SETTING(value, min, max, apply) { (uint8_t *)&(value), 0, apply, min, max }
+#define VFO_SETTING(field, min, max)    { NULL, offsetof(VFO_Info_t, field), 0, min, max }
+
+static const MenuSetting_t gMenuSettings[] =
+{
+	[MENU_SQL]          = SETTING(gEeprom.SQUELCH_LEVEL,         0, 9,                                   APPLY_CONFIGURE),
+	[MENU_TXP]          = VFO_SETTING(OUTPUT_POWER,                  0, ARRAY_SIZE(gSubMenu_TXP) - 1),
+	[MENU_SFT_D]        = VFO_SETTING(TX_OFFSET_FREQUENCY_DIRECTION, 0, ARRAY_SIZE(gSubMenu_SFT_D) - 1),
+	[MENU_TOT]          = SETTING(gEeprom.TX_TIMEOUT_TIMER,      0, ARRAY_SIZE(gSubMenu_TOT) - 1,        0),
+	[MENU_W_N]          = VFO_SETTING(CHANNEL_BANDWIDTH,             0, ARRAY_SIZE(bwNames) - 1),
+	[MENU_SCR]          = VFO_SETTING(SCRAMBLING_TYPE,               0, ARRAY_SIZE(gSubMenu_SCRAMBLER) - 1),
+	[MENU_BCL]          = VFO_SETTING(BUSY_CHANNEL_LOCK,             0, 15),
+	[MENU_MDF]          = SETTING(gEeprom.CHANNEL_DISPLAY_MODE,  0, ARRAY_SIZE(gSubMenu_MDF) - 1,        0),
+	[MENU_SAVE]         = SETTING(gEeprom.BATTERY_SAVE,          0, ARRAY_SIZE(gSubMenu_SAVE) - 1,       0),
+#ifdef ENABLE_VOX
+	[MENU_VOX_DELAY]    = SETTING(gEeprom.VOX_DELAY,             0, MR_CHANNEL_LAST,                     APPLY_CALIBRATION | APPLY_RECONFIGURE | APPLY_STATUS),
+#endif
+	[MENU_ABR]          = SETTING(gEeprom.BACKLIGHT_TIME,        0, ARRAY_SIZE(gSubMenu_BACKLIGHT) - 1,  0),
+	[MENU_ABR_ON_TX_RX] = SETTING(gSetting_backlight_on_tx_rx,   0, ARRAY_SIZE(gSubMenu_RX_TX) - 1,      0),
+#ifdef ENABLE_VOICE
+	[MENU_VOICE]        = SETTING(gEeprom.VOICE_PROMPT,          0, ARRAY_SIZE(gSubMenu_VOICE) - 1,      APPLY_STATUS),
+#endif
+	[MENU_SC_REV]       = SETTING(gEeprom.SCAN_RESUME_MODE,      0, ARRAY_SIZE(gSubMenu_SC_REV) - 1,     0),
+	[MENU_MIC]          = SETTING(gEeprom.MIC_SENSITIVITY,       0, 4,                                   APPLY_CALIBRATION | APPLY_RECONFIGURE),
+	[MENU_1_CALL]       = SETTING(gEeprom.CHAN_1_CALL,           0, MR_CHANNEL_LAST,                     0),
+#ifdef ENABLE_ALARM
+	[MENU_AL_MOD]       = SETTING(gEeprom.ALARM_MODE,            0, ARRAY_SIZE(gSubMenu_AL_MOD) - 1,     0),
+#endif
+	[MENU_PTT_ID]       = VFO_SETTING(DTMF_PTT_ID_TX_MODE,           0, ARRAY_SIZE(gSubMenu_PTT_ID) - 1),
+	[MENU_D_ST]         = SETTING(gEeprom.DTMF_SIDE_TONE,        0, ARRAY_SIZE(gSubMenu_OFF_ON) - 1,     0),
+#ifdef ENABLE_DTMF
+	[MENU_D_RSP]        = SETTING(gEeprom.DTMF_DECODE_RESPONSE,  0, ARRAY_SIZE(gSubMenu_D_RSP) - 1,      0),
+	[MENU_D_HOLD]       = SETTING(gEeprom.DTMF_auto_reset_time,  5, 60,                                  0),
+#endif
+	[MENU_PONMSG]       = SETTING(gEeprom.POWER_ON_DISPLAY_MODE, 0, ARRAY_SIZE(gSubMenu_PONMSG) - 1,     0),
+	[MENU_ROGER]        = SETTING(gEeprom.ROGER,                 0, ARRAY_SIZE(gSubMenu_ROGER) - 1,      0),
+	[MENU_BAT_TXT]      = SETTING(gSetting_battery_text,         0, ARRAY_SIZE(gSubMenu_BAT_TXT) - 1,    0),
+	[MENU_AM]           = VFO_SETTING(Modulation,                    0, ARRAY_SIZE(gModulationStr) - 1),
+#ifdef ENABLE_NOAA
+	[MENU_NOAA_S]       = SETTING(gEeprom.NOAA_AUTO_SCAN,        0, ARRAY_SIZE(gSubMenu_OFF_ON) - 1,     APPLY_RECONFIGURE),
+#endif
+	[MENU_F_LOCK]       = SETTING(gSetting_F_LOCK,               0, ARRAY_SIZE(gSubMenu_F_LOCK) - 1,     0),
+	[MENU_SCREN]        = SETTING(gSetting_ScrambleEnable,       0, ARRAY_SIZE(gSubMenu_OFF_ON) - 1,     APPLY_RECONFIGURE),
+	[MENU_BATTYP]       = SETTING(gEeprom.BATTERY_TYPE,          0, 1,                                   0),
+	[MENU_RX_AGC]       = SETTING(gEeprom.RX_AGC,                0, ARRAY_SIZE(gSubMenu_RX_AGC) - 1,     APPLY_RELOAD),
+};
+
+static const MenuSetting_t *GetSetting(uint8_t menu_id)
+{
+	if (menu_id < ARRAY_SIZE(gMenuSettings) && gMenuSettings[menu_id].Max != 0)
+		return &gMenuSettings[menu_id];
+	return NULL;
+}
+
+static uint8_t *GetSettingValue(const MenuSetting_t *pSetting)
+{
+	return pSetting->pValue ? pSetting->pValue : (uint8_t *)gTxVfo + pSetting->VfoOffset;
+}
+
+static void AcceptListedSetting(const MenuSetting_t *pSetting)
+{
+	*GetSettingValue(pSetting) = gSubMenuSelection;
+
+	if (pSetting->pValue == NULL)
+	{	// VFO settings are saved with the channel
+		gRequestSaveChannel = 1;
+		return;
+	}
+
+	if (pSetting->Apply & APPLY_CALIBRATION)
+		BOARD_EEPROM_LoadCalibration();
+	if (pSetting->Apply & APPLY_CONFIGURE)
+		gVfoConfigureMode = VFO_CONFIGURE;
+	if (pSetting->Apply & APPLY_RELOAD) {
+		gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
+		gFlagResetVfos    = true;
+	}
+	if (pSetting->Apply & APPLY_RECONFIGURE)
+		gFlagReconfigureVfos = true;
+	if (pSetting->Apply & APPLY_STATUS)
+		gUpdateStatus = true;
+
+	gRequestSaveSettings = true;
+}
+
 int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 {
-	switch (menu_id)
+	const MenuSetting_t *pSetting = GetSetting(menu_id);
+
+	if (pSetting != NULL)
 	{
-		case MENU_SQL:
-			*pMin = 0;
-			*pMax = 9;
-			break;
+		*pMin = pSetting->Min;
+		*pMax = pSetting->Max;
+		return 0;
+	}
 
+	switch (menu_id)
+	{
 		case MENU_STEP:
 			*pMin = 0;
 			*pMax = ARRAY_SIZE(gStepFrequencyTable) - 1;
 			break;
 
-		case MENU_ABR:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_BACKLIGHT) - 1;
-			break;
-
 		case MENU_ABR_MIN:
 			*pMin = 0;
 			*pMax = 9;
@@ -141,57 +247,12 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 			*pMin = 1;
 			*pMax = 10;
 			break;	
-		case MENU_F_LOCK:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_F_LOCK) - 1;
-			break;
-
-		case MENU_MDF:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_MDF) - 1;
-			break;
-
-		case MENU_TXP:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_TXP) - 1;
-			break;
-
-		case MENU_SFT_D:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_SFT_D) - 1;
-			break;
 
 		case MENU_TDR:
 			*pMin = 0;
 			*pMax = ARRAY_SIZE(gSubMenu_RXMode) - 1;
 			break;
 
-		#ifdef ENABLE_VOICE
-			case MENU_VOICE:
-				*pMin = 0;
-				*pMax = ARRAY_SIZE(gSubMenu_VOICE) - 1;
-				break;
-		#endif
-
-		case MENU_SC_REV:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_SC_REV) - 1;
-			break;
-
-		case MENU_ROGER:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_ROGER) - 1;
-			break;
-	
-		/*case MENU_TEST_RANGE:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_MENU_TEST_RANGE) - 1;
-			break;*/
-		case MENU_PONMSG:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_PONMSG) - 1;
-			break;
-
 		case MENU_R_DCS:
 		case MENU_T_DCS:
 			*pMin = 0;
@@ -210,30 +271,16 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 			*pMax = ARRAY_SIZE(CTCSS_Options) - 1;
 			break;
 
-		case MENU_W_N:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(bwNames) - 1;
-			break;
-
-		#ifdef ENABLE_ALARM
-			case MENU_AL_MOD:
-				*pMin = 0;
-				*pMax = ARRAY_SIZE(gSubMenu_AL_MOD) - 1;
-				break;
-		#endif
-
 		case MENU_RESET:
 			*pMin = 0;
 			*pMax = ARRAY_SIZE(gSubMenu_RESET) - 1;
 			break;
 
 		case MENU_COMPAND:
-		case MENU_ABR_ON_TX_RX:
 			*pMin = 0;
 			*pMax = ARRAY_SIZE(gSubMenu_RX_TX) - 1;
 			break;
 
-		case MENU_BCL:
 		case MENU_BEEP:
 		case MENU_AUTOLK:
 		case MENU_S_LIST:
@@ -241,20 +288,10 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 			*pMax = 15;
 			break;
 
-		case MENU_D_ST:
 #ifdef ENABLE_DTMF
 		case MENU_D_DCD:
-#endif
-
-#ifdef ENABLE_DTMF
 		case MENU_D_LIVE_DEC:
 #endif
-
-#ifdef ENABLE_NOAA
-		case MENU_NOAA_S:
-#endif
-
-		case MENU_SCREN:
 #ifdef ENABLE_ENCRYPTION
 		case MENU_MSG_ENC:
 #endif
@@ -273,71 +310,16 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 			break;
 #endif
 
-		case MENU_AM:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gModulationStr) - 1;
-			break;
-
-		case MENU_RX_AGC:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_RX_AGC) - 1;
-			break;
-
-		case MENU_SCR:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_SCRAMBLER) - 1;
-			break;
-
-		case MENU_TOT:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_TOT) - 1;
-			break;
-
 		#ifdef ENABLE_VOX
 			case MENU_VOX:
-			case MENU_VOX_DELAY:
 		#endif
 		case MENU_MEM_CH:
-		case MENU_1_CALL:
 		case MENU_DEL_CH:
 		case MENU_MEM_NAME:
 			*pMin = 0;
 			*pMax = MR_CHANNEL_LAST;
 			break;
 
-		case MENU_SAVE:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_SAVE) - 1;
-			break;
-
-		case MENU_MIC:
-			*pMin = 0;
-			*pMax = 4;
-			break;
-
-			
-#ifdef ENABLE_DTMF
-		case MENU_D_RSP:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_D_RSP) - 1;
-			break;
-#endif
-		case MENU_PTT_ID:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_PTT_ID) - 1;
-			break;
-
-		case MENU_BAT_TXT:
-			*pMin = 0;
-			*pMax = ARRAY_SIZE(gSubMenu_BAT_TXT) - 1;
-			break;
-
-#ifdef ENABLE_DTMF
-		case MENU_D_HOLD:
-			*pMin = 5;
-			*pMax = 60;
-			break;
-#endif
 		case MENU_D_PRE:
 			*pMin = 3;
 			*pMax = 99;
@@ -361,11 +343,6 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 			*pMax = 2200;
 			break;
 
-		case MENU_BATTYP:
-			*pMin = 0;
-			*pMax = 1;
-			break;
-		
 		case MENU_F1SHRT:
 		case MENU_F1LONG:
 		case MENU_F2SHRT:
@@ -384,10 +361,11 @@ int MENU_GetLimits(uint8_t menu_id, int32_t *pMin, int32_t *pMax)
 
 void MENU_AcceptSetting(void)
 {
-	int32_t        Min;
-	int32_t        Max;
-	uint8_t        Code;
-	FREQ_Config_t *pConfig = &gTxVfo->freq_config_RX;
+	const MenuSetting_t *pSetting = GetSetting(UI_MENU_GetCurrentMenuId());
+	int32_t              Min;
+	int32_t              Max;
+	uint8_t              Code;
+	FREQ_Config_t       *pConfig = &gTxVfo->freq_config_RX;
 
 	if (!MENU_GetLimits(UI_MENU_GetCurrentMenuId(), &Min, &Max))
 	{
@@ -396,16 +374,17 @@ void MENU_AcceptSetting(void)
 		if (gSubMenuSelection > Max) gSubMenuSelection = Max;
 	}
 
+	if (pSetting != NULL)
+	{
+		AcceptListedSetting(pSetting);
+		return;
+	}
+
 	switch (UI_MENU_GetCurrentMenuId())
 	{
 		default:
 			return;
 
-		case MENU_SQL:
-			gEeprom.SQUELCH_LEVEL = gSubMenuSelection;
-			gVfoConfigureMode     = VFO_CONFIGURE;
-			break;
-
 		case MENU_STEP:
 			gTxVfo->STEP_SETTING = FREQUENCY_GetStepIdxFromSortedIdx(gSubMenuSelection);
 			if (IS_FREQ_CHANNEL(gTxVfo->CHANNEL_SAVE))
@@ -415,11 +394,6 @@ void MENU_AcceptSetting(void)
 			}
 			return;
 
-		case MENU_TXP:
-			gTxVfo->OUTPUT_POWER = gSubMenuSelection;
-			gRequestSaveChannel = 1;
-			return;
-
 		case MENU_T_DCS:
 			pConfig = &gTxVfo->freq_config_TX;
 
@@ -481,11 +455,6 @@ void MENU_AcceptSetting(void)
 			gRequestSaveChannel = 1;
 			return;
 
-		case MENU_SFT_D:
-			gTxVfo->TX_OFFSET_FREQUENCY_DIRECTION = gSubMenuSelection;
-			gRequestSaveChannel                   = 1;
-			return;
-
 		case MENU_OFFSET:
 			gTxVfo->TX_OFFSET_FREQUENCY = gSubMenuSelection;
 			gRequestSaveChannel         = 1;
@@ -531,27 +500,6 @@ void MENU_AcceptSetting(void)
 				break;
 		#endif
 
-		case MENU_W_N:
-			gTxVfo->CHANNEL_BANDWIDTH = gSubMenuSelection;
-			gRequestSaveChannel       = 1;
-			return;
-
-		case MENU_SCR:
-			gTxVfo->SCRAMBLING_TYPE = gSubMenuSelection;
-			#if 0
-				if (gSubMenuSelection > 0 && gSetting_ScrambleEnable)
-					BK4819_EnableScramble(gSubMenuSelection - 1);
-				else
-					BK4819_DisableScramble();
-			#endif
-			gRequestSaveChannel     = 1;
-			return;
-
-		case MENU_BCL:
-			gTxVfo->BUSY_CHANNEL_LOCK = gSubMenuSelection;
-			gRequestSaveChannel       = 1;
-			return;
-
 		case MENU_MEM_CH:
 			gTxVfo->CHANNEL_SAVE = gSubMenuSelection;
 			#if 0
@@ -577,10 +525,6 @@ void MENU_AcceptSetting(void)
 			SETTINGS_SaveChannelName(gSubMenuSelection, edit);
 			return;
 
-		case MENU_SAVE:
-			gEeprom.BATTERY_SAVE = gSubMenuSelection;
-			break;
-
 		#ifdef ENABLE_VOX
 			case MENU_VOX:
 				gEeprom.VOX_SWITCH = gSubMenuSelection != 0;
@@ -590,19 +534,8 @@ void MENU_AcceptSetting(void)
 				gFlagReconfigureVfos = true;
 				gUpdateStatus        = true;
 				break;
-
-			case MENU_VOX_DELAY:
-				gEeprom.VOX_DELAY = gSubMenuSelection;
-				BOARD_EEPROM_LoadCalibration();
-				gFlagReconfigureVfos = true;
-				gUpdateStatus        = true;
-				break;
 		#endif
 
-		case MENU_ABR:
-			gEeprom.BACKLIGHT_TIME = gSubMenuSelection;
-			break;
-
 		case MENU_ABR_MIN:
 			gEeprom.BACKLIGHT_MIN = gSubMenuSelection;
 			gEeprom.BACKLIGHT_MAX = MAX(gSubMenuSelection + 1 , gEeprom.BACKLIGHT_MAX);
@@ -613,10 +546,6 @@ void MENU_AcceptSetting(void)
 			gEeprom.BACKLIGHT_MIN = MIN(gSubMenuSelection - 1, gEeprom.BACKLIGHT_MIN);
 			break;			
 
-		case MENU_ABR_ON_TX_RX:
-			gSetting_backlight_on_tx_rx = gSubMenuSelection;
-			break;
-
 		case MENU_TDR:
 			gEeprom.DUAL_WATCH = (gEeprom.TX_VFO + 1) * (gSubMenuSelection & 1);
 			gEeprom.CROSS_BAND_RX_TX = (gEeprom.TX_VFO + 1) * ((gSubMenuSelection & 2) > 0);
@@ -629,25 +558,6 @@ void MENU_AcceptSetting(void)
 			gEeprom.BEEP_CONTROL = gSubMenuSelection;
 			break;
 
-		case MENU_TOT:
-			gEeprom.TX_TIMEOUT_TIMER = gSubMenuSelection;
-			break;
-
-		#ifdef ENABLE_VOICE
-			case MENU_VOICE:
-				gEeprom.VOICE_PROMPT = gSubMenuSelection;
-				gUpdateStatus        = true;
-				break;
-		#endif
-
-		case MENU_SC_REV:
-			gEeprom.SCAN_RESUME_MODE = gSubMenuSelection;
-			break;
-
-		case MENU_MDF:
-			gEeprom.CHANNEL_DISPLAY_MODE = gSubMenuSelection;
-			break;
-
 		case MENU_AUTOLK:
 			gEeprom.AUTO_KEYPAD_LOCK = gSubMenuSelection;
 			gKeyLockCountdown        = 30;
@@ -660,12 +570,6 @@ void MENU_AcceptSetting(void)
 			gFlagResetVfos    = true;
 			return;
 
-		case MENU_MIC:
-			gEeprom.MIC_SENSITIVITY = gSubMenuSelection;
-			BOARD_EEPROM_LoadCalibration();
-			gFlagReconfigureVfos = true;
-			break;
-
 		case MENU_COMPAND:
 			gTxVfo->Compander = gSubMenuSelection;
 			SETTINGS_UpdateChannel(gTxVfo->CHANNEL_SAVE, gTxVfo, true);
@@ -674,42 +578,10 @@ void MENU_AcceptSetting(void)
 //			gRequestSaveChannel = 1;
 			return;
 
-		case MENU_1_CALL:
-			gEeprom.CHAN_1_CALL = gSubMenuSelection;
-			break;
-
-		#ifdef ENABLE_ALARM
-			case MENU_AL_MOD:
-				gEeprom.ALARM_MODE = gSubMenuSelection;
-				break;
-		#endif
-
-		case MENU_D_ST:
-			gEeprom.DTMF_SIDE_TONE = gSubMenuSelection;
-			break;
-
-#ifdef ENABLE_DTMF
-		case MENU_D_RSP:
-			gEeprom.DTMF_DECODE_RESPONSE = gSubMenuSelection;
-			break;
-
-		case MENU_D_HOLD:
-			gEeprom.DTMF_auto_reset_time = gSubMenuSelection;
-			break;
-#endif
 		case MENU_D_PRE:
 			gEeprom.DTMF_PRELOAD_TIME = gSubMenuSelection * 10;
 			break;
 
-		case MENU_PTT_ID:
-			gTxVfo->DTMF_PTT_ID_TX_MODE = gSubMenuSelection;
-			gRequestSaveChannel         = 1;
-			return;
-
-		case MENU_BAT_TXT:
-			gSetting_battery_text = gSubMenuSelection;
-			break;
-
 #ifdef ENABLE_DTMF
 		case MENU_D_DCD:
 			gTxVfo->DTMF_DECODING_ENABLE = gSubMenuSelection;
@@ -743,38 +615,12 @@ void MENU_AcceptSetting(void)
 			}
 			return;
 #endif
-		case MENU_PONMSG:
-			gEeprom.POWER_ON_DISPLAY_MODE = gSubMenuSelection;
-			break;
-
-		case MENU_ROGER:
-			gEeprom.ROGER = gSubMenuSelection;
-			break;
-
-		case MENU_AM:
-			gTxVfo->Modulation     = gSubMenuSelection;
-			gRequestSaveChannel = 1;
-			return;
-
-		case MENU_RX_AGC:
-			gEeprom.RX_AGC    = gSubMenuSelection;
-			gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
-			gFlagResetVfos    = true;
-			break;
-
 		case MENU_SQL_TONE:
 			gEeprom.SQL_TONE = gSubMenuSelection;
 			gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
 			gFlagResetVfos    = true;
 			break;
 
-		#ifdef ENABLE_NOAA
-			case MENU_NOAA_S:
-				gEeprom.NOAA_AUTO_SCAN = gSubMenuSelection;
-				gFlagReconfigureVfos   = true;
-				break;
-		#endif
-
 		case MENU_DEL_CH:
 			SETTINGS_UpdateChannel(gSubMenuSelection, NULL, false);
 			gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
@@ -785,16 +631,6 @@ void MENU_AcceptSetting(void)
 			BOARD_FactoryReset(gSubMenuSelection);
 			return;
 
-		case MENU_F_LOCK: {
-			gSetting_F_LOCK = gSubMenuSelection;
-			break;
-		}
-
-		case MENU_SCREN:
-			gSetting_ScrambleEnable = gSubMenuSelection;
-			gFlagReconfigureVfos    = true;
-			break;
-
 		#ifdef ENABLE_F_CAL_MENU
 			case MENU_F_CALI:
 				writeXtalFreqCal(gSubMenuSelection, true);
@@ -813,10 +649,6 @@ void MENU_AcceptSetting(void)
 			return;
 		}
 
-		case MENU_BATTYP:
-			gEeprom.BATTERY_TYPE = gSubMenuSelection;
-			break;
-
 		case MENU_F1SHRT:
 		case MENU_F1LONG:
 		case MENU_F2SHRT:
@@ -855,20 +687,20 @@ static void MENU_ClampSelection(int8_t Direction)
 
 void MENU_ShowCurrentSetting(void)
 {
-	switch (UI_MENU_GetCurrentMenuId())
+	const MenuSetting_t *pSetting = GetSetting(UI_MENU_GetCurrentMenuId());
+
+	if (pSetting != NULL)
 	{
-		case MENU_SQL:
-			gSubMenuSelection = gEeprom.SQUELCH_LEVEL;
-			break;
+		gSubMenuSelection = *GetSettingValue(pSetting);
+		return;
+	}
 
+	switch (UI_MENU_GetCurrentMenuId())
+	{
 		case MENU_STEP:
 			gSubMenuSelection = FREQUENCY_GetSortedIdxFromStepIdx(gTxVfo->STEP_SETTING);
 			break;
 
-		case MENU_TXP:
-			gSubMenuSelection = gTxVfo->OUTPUT_POWER;
-			break;
-
 		case MENU_RESET:
 			gSubMenuSelection = 0;
 			break;			
@@ -924,10 +756,6 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = (gTxVfo->freq_config_TX.CodeType == CODE_TYPE_CONTINUOUS_TONE) ? gTxVfo->freq_config_TX.Code + 1 : 0;
 			break;
 
-		case MENU_SFT_D:
-			gSubMenuSelection = gTxVfo->TX_OFFSET_FREQUENCY_DIRECTION;
-			break;
-
 		case MENU_OFFSET:
 			gSubMenuSelection = gTxVfo->TX_OFFSET_FREQUENCY;
 			break;
@@ -962,18 +790,6 @@ void MENU_ShowCurrentSetting(void)
 				break;
 	    #endif
 
-		case MENU_W_N:
-			gSubMenuSelection = gTxVfo->CHANNEL_BANDWIDTH;
-			break;
-
-		case MENU_SCR:
-			gSubMenuSelection = gTxVfo->SCRAMBLING_TYPE;
-			break;
-
-		case MENU_BCL:
-			gSubMenuSelection = gTxVfo->BUSY_CHANNEL_LOCK;
-			break;
-
 		case MENU_MEM_CH:
 			//todo: in vfo mode select last empty channel slot
 			gSubMenuSelection = gEeprom.MrChannel[gEeprom.TX_VFO];
@@ -983,23 +799,12 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = gEeprom.MrChannel[gEeprom.TX_VFO];
 			break;
 
-		case MENU_SAVE:
-			gSubMenuSelection = gEeprom.BATTERY_SAVE;
-			break;
-
 		#ifdef ENABLE_VOX
 		case MENU_VOX:
 			gSubMenuSelection = gEeprom.VOX_SWITCH ? gEeprom.VOX_LEVEL + 1 : 0;
 			break;
-		case MENU_VOX_DELAY:
-			gSubMenuSelection = gEeprom.VOX_DELAY;
-			break;
 		#endif
 
-		case MENU_ABR:
-			gSubMenuSelection = gEeprom.BACKLIGHT_TIME;
-			break;
-
 		case MENU_ABR_MIN:
 			gSubMenuSelection = gEeprom.BACKLIGHT_MIN;
 			break;
@@ -1008,10 +813,6 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = gEeprom.BACKLIGHT_MAX;
 			break;		
 
-		case MENU_ABR_ON_TX_RX:
-			gSubMenuSelection = gSetting_backlight_on_tx_rx;
-			break;
-
 		case MENU_TDR:
 			gSubMenuSelection = (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) + (gEeprom.CROSS_BAND_RX_TX != CROSS_BAND_OFF) * 2;
 			break;
@@ -1020,24 +821,6 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = gEeprom.BEEP_CONTROL;
 			break;
 
-		case MENU_TOT:
-			gSubMenuSelection = gEeprom.TX_TIMEOUT_TIMER;
-			break;
-
-#ifdef ENABLE_VOICE
-		case MENU_VOICE:
-			gSubMenuSelection = gEeprom.VOICE_PROMPT;
-			break;
-#endif
-
-		case MENU_SC_REV:
-			gSubMenuSelection = gEeprom.SCAN_RESUME_MODE;
-			break;
-
-		case MENU_MDF:
-			gSubMenuSelection = gEeprom.CHANNEL_DISPLAY_MODE;
-			break;
-
 		case MENU_AUTOLK:
 			gSubMenuSelection = gEeprom.AUTO_KEYPAD_LOCK;
 			break;
@@ -1046,49 +829,14 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = gTxVfo->SCANLIST;
 			break;
 
-		case MENU_MIC:
-			gSubMenuSelection = gEeprom.MIC_SENSITIVITY;
-			break;
-
 		case MENU_COMPAND:
 			gSubMenuSelection = gTxVfo->Compander;
 			return;
 
-		case MENU_1_CALL:
-			gSubMenuSelection = gEeprom.CHAN_1_CALL;
-			break;
-
-		#ifdef ENABLE_ALARM
-			case MENU_AL_MOD:
-				gSubMenuSelection = gEeprom.ALARM_MODE;
-				break;
-		#endif
-
-		case MENU_D_ST:
-			gSubMenuSelection = gEeprom.DTMF_SIDE_TONE;
-			break;
-
-#ifdef ENABLE_DTMF
-		case MENU_D_RSP:
-			gSubMenuSelection = gEeprom.DTMF_DECODE_RESPONSE;
-			break;
-
-		case MENU_D_HOLD:
-			gSubMenuSelection = gEeprom.DTMF_auto_reset_time;
-			break;
-#endif
 		case MENU_D_PRE:
 			gSubMenuSelection = gEeprom.DTMF_PRELOAD_TIME / 10;
 			break;
 
-		case MENU_PTT_ID:
-			gSubMenuSelection = gTxVfo->DTMF_PTT_ID_TX_MODE;
-			break;
-
-		case MENU_BAT_TXT:
-			gSubMenuSelection = gSetting_battery_text;
-			return;
-
 #ifdef ENABLE_DTMF
 		case MENU_D_DCD:
 			gSubMenuSelection = gTxVfo->DTMF_DECODING_ENABLE;
@@ -1104,32 +852,10 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = gSetting_live_DTMF_decoder;
 			break;
 #endif
-		case MENU_PONMSG:
-			gSubMenuSelection = gEeprom.POWER_ON_DISPLAY_MODE;
-			break;
-
-		case MENU_ROGER:
-			gSubMenuSelection = gEeprom.ROGER;
-			break;
-
-		case MENU_AM:
-			gSubMenuSelection = gTxVfo->Modulation;
-			break;
-
-		case MENU_RX_AGC:
-			gSubMenuSelection = gEeprom.RX_AGC;
-			break;
-		
 		case MENU_SQL_TONE:
 			gSubMenuSelection = gEeprom.SQL_TONE;
 			break;
 
-		#ifdef ENABLE_NOAA
-			case MENU_NOAA_S:
-				gSubMenuSelection = gEeprom.NOAA_AUTO_SCAN;
-				break;
-		#endif
-
 		case MENU_DEL_CH:
 			#if 0
 				gSubMenuSelection = RADIO_FindNextChannel(gEeprom.MrChannel[0], 1, false, 1);
@@ -1138,14 +864,6 @@ void MENU_ShowCurrentSetting(void)
 			#endif
 			break;
 
-		case MENU_F_LOCK:
-			gSubMenuSelection = gSetting_F_LOCK;
-			break;
-
-		case MENU_SCREN:
-			gSubMenuSelection = gSetting_ScrambleEnable;
-			break;
-
 		#ifdef ENABLE_F_CAL_MENU
 			case MENU_F_CALI:
 				gSubMenuSelection = gEeprom.BK4819_XTAL_FREQ_LOW;
@@ -1156,10 +874,6 @@ void MENU_ShowCurrentSetting(void)
 			gSubMenuSelection = gBatteryCalibration[3];
 			break;
 
-		case MENU_BATTYP:
-			gSubMenuSelection = gEeprom.BATTERY_TYPE;
-			break;			
-
 		case MENU_F1SHRT:
 		case MENU_F1LONG:
 		case MENU_F2SHRT:
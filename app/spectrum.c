@@ -3,6 +3,13 @@
 #include "scanner.h"
 #include "driver/backlight.h"
 #include "driver/eeprom.h"   // EEPROM_ReadBuffer()
+#include "driver/uart.h"
+#include "helper/format.h"
+#include "helper/journal.h"
+#include "helper/profiler.h"
+#include "app/eventlog.h"
+#include "scheduler.h"
+#include "app/uart.h"
 #include "audio.h"
 #include "ui/helper.h"
 #include "common.h"
@@ -22,16 +29,21 @@
 uint8_t DelayRssi=11;
 uint8_t RandomEmission = 0;
 uint16_t SpectrumDelay = 0;
+// screen refresh cap, 10ms ticks between frames for 10, 12, 16, 20 and 25 fps
+static const uint8_t frameTicks[] = {10, 8, 6, 5, 4};
+uint8_t FrameRate = 3;
 #ifdef ENABLE_NINJA
-#define PARAMETER_COUNT 3
+#define PARAMETER_COUNT 5
 #else 
-#define PARAMETER_COUNT 2
+#define PARAMETER_COUNT 4
 #endif
+#define PARAMETER_FRAMERATE (PARAMETER_COUNT - 2)
+#define PARAMETER_DISPLAY (PARAMETER_COUNT - 1)
 
 /////////////////////////////
 
 uint16_t WaitSpectrum = 0; 
-#define SQUELCH_OFF_DELAY 10;
+#define SQUELCH_OFF_DELAY 1  // SysTicks between two squelch checks while listening
 bool FreeTriggerLevel = 0;
 bool StorePtt_Toggle_Mode = 0;
 bool PopUpclear = 0;
@@ -50,6 +62,29 @@ uint8_t scanListScrollOffset = 0;
 uint8_t parametersSelectedIndex = 0;
 uint8_t parametersScrollOffset = 0;
 static uint8_t validScanListCount = 0;
+
+#define LIST_LINE_CHARS 18                                // small font characters on a line
+#define LIST_ALL_LINES  ((1u << MAX_VISIBLE_LINES) - 1)
+typedef void (*ListItemText_t)(uint8_t index, char *buffer);
+// what the list lines below the title show, see RenderListView()
+static struct {
+  ListItemText_t getItemText;   // NULL when the frame buffer holds something else
+  uint8_t linesPerItem;
+  uint8_t numItems;
+  uint8_t selected;
+  uint8_t scrollOffset;
+  uint8_t staleLines;           // bit per line, text to be fetched again
+  char title[24];
+  char text[MAX_VISIBLE_LINES][LIST_LINE_CHARS + 1];
+} listView;
+static void ListView_Invalidate();
+static void ListView_RefreshItem(ListItemText_t getItemText, uint8_t index);
+static void ListView_RefreshAll();
+static void GetHistoryItemText(uint8_t index, char* buffer);
+static void GetBandItemText(uint8_t index, char* buffer);
+static void GetParametersText(uint8_t index, char *buffer);
+static void GetFilteredScanListText(uint8_t displayIndex, char* buffer);
+static void BuildValidScanListIndices();
 bool inScanListMenu = false;
 KeyboardState kbd = {KEY_INVALID, KEY_INVALID, 0,0};
 bool AutoTriggerLevelbandsMode = 0;
@@ -79,6 +114,8 @@ void ToggleScanList();
 void ToggleNormalizeRssi(bool on);
 static void LoadSettings();
 static void SaveSettings();
+static void LoadSnapshot();
+static void SaveSnapshot();
 static void AutoTriggerLevel(void);
 static void AutoTriggerLevelbands(void);
 const uint16_t RSSI_MAX_VALUE = 65535;
@@ -96,6 +133,8 @@ ModulationMode_t  channelModulation;
 BK4819_FilterBandwidth_t channelBandwidth;
 void LoadValidMemoryChannels(void);
 bool isInitialized = false;
+static bool remoteSweep;           // a UART sweep owns the radio
+static uint32_t remoteSweepF;      // fMeasure before the sweep
 bool isListening = true;
 bool monitorMode = false;
 bool redrawStatus = true;
@@ -113,6 +152,15 @@ ScanInfo scanInfo;
 static uint16_t blacklistFreqs[BLACKLIST_SIZE];
 static uint8_t blacklistFreqsIdx;
 static bool IsBlacklisted(uint16_t idx);
+#define OCCUPANCY_QUIET 0   // nothing over the trigger lately, the band is swept every 4th round while another one is busy
+#define OCCUPANCY_STUCK 230 // ~90%, the bin is suggested for the blacklist
+static uint8_t occupancy[128];     // per bin, share of samples over the trigger, 255: always
+static uint8_t bandOccupancy[32];  // per BParams band, share of its samples over the trigger
+static uint8_t bandSkip[32];
+static uint16_t sweepBusy, sweepSamples;
+static uint32_t sweepStart;         // what the bins cover, see CheckOccupancyGeometry()
+static uint16_t sweepStep, sweepCount;
+bool ShowOccupancy = false;
 static uint8_t CurrentScanIndex();
 char     latestScanListName[12];
 const char *bwOptions[] = {"  25k", "12.5k", "6.25k"};
@@ -141,9 +189,12 @@ SpectrumSettings settings = {stepsCount: STEPS_128,
 uint32_t fMeasure = 0;
 uint32_t currentFreq, tempFreq;
 uint16_t rssiHistory[128];
+// loudest reading of each bin since the last frame, the sweeps can outrun the screen
+static uint16_t heldHistory[128];
 const uint8_t FMaxNumb = HISTORY_SIZE;
 uint32_t freqHistory[HISTORY_SIZE+1]= {0};
 uint8_t freqCount[HISTORY_SIZE+1] = {0};
+static uint8_t historyCount = 0;   // entries in use, freqHistory[1..historyCount]
 uint8_t indexFd = 0;
 uint8_t indexFs = 1;
 bool ShowHistory = false;
@@ -156,6 +207,7 @@ static uint8_t nextBandToScanIndex = 0; // Indeks następnego pasma do sprawdzen
 
 uint8_t menuState = 0;
 uint16_t listenT = 0;
+static uint32_t listenTick;   // SCHEDULER_GetTick() when listenT was last counted down
 uint8_t rxChannelDisplayCountdown = 0;
 //
 static bool wasReceiving = false;
@@ -226,6 +278,10 @@ void SetState(State state) {
   currentState = state;
   redrawScreen = true;
   redrawStatus = true;
+  ListView_Invalidate();
+  // peaks held while another screen was up are stale
+  if (state == SPECTRUM)
+    memset(heldHistory, 0, sizeof(heldHistory));
 }
 
 // Radio functions
@@ -336,19 +392,21 @@ static void TuneToPeak() {
 }
 static void DeInitSpectrum(bool ComeBack) {
   
+  EVENTLOG_Save();
+  SaveSnapshot();
   RestoreRegisters();
   gVfoConfigureMode = VFO_CONFIGURE;
   isInitialized = false;
   SetState(SPECTRUM);
   if(!ComeBack) {
     uint8_t Spectrum_state = 0; //Spectrum Not Active
-    EEPROM_WriteBuffer(0x1D00, &Spectrum_state, 1);
+    JOURNAL_Write(JOURNAL_KEY_SPECTRUM, &Spectrum_state);
     }
     
   else {
-    EEPROM_ReadBuffer(0x1D00, &Spectrum_state, 1);
+    JOURNAL_Read(JOURNAL_KEY_SPECTRUM, &Spectrum_state);
 	  Spectrum_state+=10;
-    EEPROM_WriteBuffer(0x1D00, &Spectrum_state, 1);
+    JOURNAL_Write(JOURNAL_KEY_SPECTRUM, &Spectrum_state);
     StorePtt_Toggle_Mode = Ptt_Toggle_Mode;
     Ptt_Toggle_Mode =0;
     }
@@ -463,6 +521,7 @@ void FillfreqHistory(bool count) {
             // 2. (This is a different frequency OR we weren't receiving before on any frequency)
             if (count && (lastReceivingFreq != scanInfo.f || !wasReceiving)) {
                 freqCount[i]++;
+                ListView_RefreshItem(GetHistoryItemText, i - 1);
                 // Update state to indicate we're now receiving on this frequency
                 wasReceiving = true;
                 lastReceivingFreq = scanInfo.f;
@@ -474,8 +533,10 @@ void FillfreqHistory(bool count) {
     }
 
     // If we get here, it's a new frequency
+    if (freqHistory[indexFs] == 0) historyCount++;
     freqHistory[indexFs] = scanInfo.f;
     freqCount[indexFs] = 1; // Start count at 1 for new detections
+    ListView_RefreshItem(GetHistoryItemText, indexFs - 1);
     indexFd = indexFs; // Set current display index
     
     // Advance storage index with wrap-around
@@ -498,6 +559,14 @@ static void ResetReceivingState() {
 
 
 static void ToggleRX(bool on) {
+    // one log event per squelch opening, monitor mode opens it without a signal
+    if (on && !isListening && !monitorMode) {
+        const uint32_t f = (currentState == STILL) ? fMeasure : peak.f;
+        EVENTLOG_Start(f, peak.rssi, (isKnownChannel && f == peak.f) ? channel : EVENTLOG_NO_CHANNEL);
+    } else if (!on && isListening) {
+        EVENTLOG_Stop();
+    }
+
     isListening = on;
     BACKLIGHT_TurnOn();
     
@@ -519,6 +588,7 @@ static void ToggleRX(bool on) {
     
     if (on) { 
         listenT = SQUELCH_OFF_DELAY;
+        listenTick = SCHEDULER_GetTick();
         BK4819_SetFilterBandwidth(settings.listenBw, false);
         // turn on CSS tail found interrupt
         BK4819_WriteRegister(BK4819_REG_3F, BK4819_REG_02_CxCSS_TAIL);
@@ -556,6 +626,78 @@ bool SingleBandCheck(void) {
     return (count == 1);
 }
 
+// Occupancy
+
+// exponential average over about 16 samples, reaches both 0 and 255
+static uint8_t AverageOccupancy(uint8_t v, bool busy) {
+  if (busy)
+    return v + ((255 - v + 15) >> 4);
+  return v - ((v + 15) >> 4);
+}
+
+static void UpdateOccupancy(uint16_t rssi) {
+  const bool busy = rssi > settings.rssiTriggerLevel;
+  const uint8_t idx = CurrentScanIndex();
+
+  occupancy[idx] = AverageOccupancy(occupancy[idx], busy);
+  sweepBusy += busy;
+  sweepSamples++;
+}
+
+static uint8_t OccupancyPercent(uint8_t v) {
+  return (v * 100 + 127) / 255;
+}
+
+// bins only keep their meaning while the sweep covers the same frequencies
+static void CheckOccupancyGeometry() {
+  if (scanInfo.f != sweepStart || scanInfo.scanStep != sweepStep || scanInfo.measurementsCount != sweepCount) {
+    sweepStart = scanInfo.f;
+    sweepStep = scanInfo.scanStep;
+    sweepCount = scanInfo.measurementsCount;
+    memset(occupancy, 0, sizeof(occupancy));
+  }
+  sweepBusy = sweepSamples = 0;
+}
+
+static void UpdateBandOccupancy() {
+  if (appMode != SCAN_BAND_MODE || sweepSamples == 0)
+    return;
+
+  // rounded up, a single busy sample still counts
+  const int ratio = ((uint32_t)sweepBusy * 255 + sweepSamples - 1) / sweepSamples;
+  const int delta = ratio - bandOccupancy[bl];
+  bandOccupancy[bl] += (delta + (delta > 0 ? 7 : -7)) / 8;
+}
+
+static bool IsBandBusy(uint8_t band) {
+  return settings.bandEnabled[band] && bandOccupancy[band] > OCCUPANCY_QUIET;
+}
+
+static bool SkipQuietBand(uint8_t band) {
+  if (IsBandBusy(band))
+    return false;
+
+  for (uint8_t i = 0; i < ARRAY_SIZE(bandOccupancy); i++)
+    if (IsBandBusy(i))
+      return (bandSkip[band]++ & 3) != 0;
+
+  return false;
+}
+
+static bool IsBlacklistSuggested(uint8_t idx) {
+  return occupancy[idx] >= OCCUPANCY_STUCK && !IsBlacklisted(idx) && rssiHistory[idx] != RSSI_MAX_VALUE;
+}
+
+// bins are scan indexes only up to 128 steps, beyond that a bin covers several of them
+static uint8_t CountBlacklistSuggestions() {
+  uint8_t n = 0;
+  if (scanInfo.measurementsCount > ARRAY_SIZE(occupancy))
+    return 0;
+  for (uint8_t i = 0; i < ARRAY_SIZE(occupancy); i++)
+    n += IsBlacklistSuggested(i);
+  return n;
+}
+
 static bool InitScan() {
     ResetScanStats();
     scanInfo.i = 0;
@@ -565,7 +707,7 @@ static bool InitScan() {
     if (appMode == SCAN_BAND_MODE) {
         uint8_t checkedBandCount = 0; // Licznik sprawdzonych pasm, aby uniknąć nieskończonej pętli
         while (checkedBandCount < 32) { // Sprawdź wszystkie 15 pasm co najwyżej raz
-            if (settings.bandEnabled[nextBandToScanIndex]) {
+            if (settings.bandEnabled[nextBandToScanIndex] && !SkipQuietBand(nextBandToScanIndex)) {
                 bl = nextBandToScanIndex; // Użyj bieżącego jako aktywnego
                 scanInfo.f = BParams[bl].Startfrequency;
                 scanInfo.scanStep = scanStepValues[BParams[bl].scanStep];
@@ -597,6 +739,7 @@ static bool InitScan() {
     }
 	if(appMode==CHANNEL_MODE)
     scanInfo.measurementsCount++;
+    CheckOccupancyGeometry();
     return scanInitializedSuccessfully;
 }
 
@@ -641,6 +784,7 @@ static void ResetModifiers() {
 static void RelaunchScan() {
     ResetPeak();
     InitScan();
+    memset(heldHistory, 0, sizeof(heldHistory));
     ToggleRX(false);
     preventKeypress = true;
     scanInfo.rssiMin = RSSI_MAX_VALUE;
@@ -682,6 +826,8 @@ static void Measure()
 { 
     uint16_t rssi = scanInfo.rssi = GetRssi();
     
+    if (isListening) EVENTLOG_Update(rssi);
+    else if (currentState == SPECTRUM) UpdateOccupancy(rssi);
     if (IsPeakOverLevel())  {FillfreqHistory(true);}
     else if (IsPeakOverLevelH()) FillfreqHistory(false);
     if(scanInfo.measurementsCount > 128) {
@@ -689,9 +835,11 @@ static void Measure()
       if(rssiHistory[idx] < rssi || isListening)
         rssiHistory[idx] = rssi;
       rssiHistory[(idx+1)%128] = 0;
+      if (heldHistory[idx] < rssi) heldHistory[idx] = rssi;
       return;
     }
   rssiHistory[scanInfo.i] = rssi;
+  if (scanInfo.i < ARRAY_SIZE(heldHistory) && heldHistory[scanInfo.i] < rssi) heldHistory[scanInfo.i] = rssi;
 }
 
 // Update things by keypress
@@ -907,6 +1055,19 @@ static void Blacklist() {
   ResetScanStats();
 }
 
+static void BlacklistBusyBins() {
+  for (uint8_t i = 0; i < ARRAY_SIZE(occupancy); i++) {
+    if (IsBlacklistSuggested(i)) {
+      blacklistFreqs[blacklistFreqsIdx++ % ARRAY_SIZE(blacklistFreqs)] = i;
+      rssiHistory[i] = RSSI_MAX_VALUE;
+      isBlacklistApplied = true;
+    }
+  }
+  ResetPeak();
+  ToggleRX(false);
+  ResetScanStats();
+}
+
 // Draw things
 
 // applied x2 to prevent initial rounding
@@ -922,8 +1083,44 @@ uint8_t Rssi2PX(uint16_t rssi, uint8_t pxMin, uint8_t pxMax) {
   return ((dbm - DB_MIN) * PX_RANGE + DB_RANGE / 2) / DB_RANGE + pxMin;
 }
 
+// rssiForY[k] is the lowest rssi that Rssi2PX(rssi, 0, DrawingEndY) puts at k or above,
+// rebuilt when the dB scale changes so a bar costs a short search instead of a division
+static uint16_t rssiForY[DrawingEndY + 1];
+static int16_t rssiForYMin = 1, rssiForYMax;
+
+static void UpdateRssi2YTable() {
+  const int DB_MIN = settings.dbMin << 1;
+  const int DB_RANGE = (settings.dbMax << 1) - DB_MIN;
+
+  if (settings.dbMin == rssiForYMin && settings.dbMax == rssiForYMax)
+    return;
+  rssiForYMin = settings.dbMin;
+  rssiForYMax = settings.dbMax;
+
+  for (int k = 0; k <= DrawingEndY; k++) {
+    // smallest d in [0, DB_RANGE] with (d * DrawingEndY + DB_RANGE / 2) / DB_RANGE >= k
+    int d = 0;
+    if (DB_RANGE > 0) {
+      d = k * DB_RANGE - DB_RANGE / 2;
+      d = (d <= 0) ? 0 : (d + DrawingEndY - 1) / DrawingEndY;
+    }
+    rssiForY[k] = clamp(d + DB_MIN + (160 << 1), 0, 0xFFFF);
+  }
+}
+
 uint8_t Rssi2Y(uint16_t rssi) {
-  return DrawingEndY - Rssi2PX(rssi, 0, DrawingEndY);
+  uint8_t lo = 0, hi = DrawingEndY;
+
+  UpdateRssi2YTable();
+
+  while (lo < hi) {
+    const uint8_t mid = (lo + hi + 1) >> 1;
+    if (rssi >= rssiForY[mid])
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return DrawingEndY - lo;
 }
 
 static void DrawSpectrum()
@@ -937,51 +1134,67 @@ static void DrawSpectrum()
         uint8_t ox = 0;
         for (uint8_t i = 0; i < 127; ++i)
         {
-            uint16_t rssi = rssiHistory[1+ (i >> settings.stepsCount)];//Robby69 first bar display
+            uint8_t bin = 1+ (i >> settings.stepsCount);//Robby69 first bar display
+            uint16_t rssi = rssiHistory[bin];
             if (rssi != RSSI_MAX_VALUE)
             {
+                if (rssi < heldHistory[bin]) rssi = heldHistory[bin];
+                uint8_t y = ShowOccupancy ? DrawingEndY - occupancy[bin] * DrawingEndY / 255 : Rssi2Y(rssi);
                 // stretch bars to fill the screen width
                 uint8_t x = i * 128 / bars + shift_graph;
                 for (uint8_t xx = ox; xx < x; xx++)
                 {
-                    DrawVLine(Rssi2Y(rssi), DrawingEndY, xx, true);
+                    DrawVLine(y, DrawingEndY, xx, true);
                 }
                 ox = x;
             }
         }
+        // drawn once, the next frame holds the sweeps after this one
+        memset(heldHistory, 0, sizeof(heldHistory));
     }
 
 
 static void DrawStatus() {
-  int len=0;
-  int pos=0;
-  len = sprintf(&String[pos],"%s %ddb %s ", gModulationStr[settings.modulationType],settings.dbMax,bwNames[settings.listenBw] );
-  pos += len;  // Move position forward
+  char *p = String;
+  p = FORMAT_String(p, gModulationStr[settings.modulationType]);
+  p = FORMAT_String(p, " ");
+  p = FORMAT_Signed(p, settings.dbMax, 0, 0);
+  p = FORMAT_String(p, "db ");
+  p = FORMAT_String(p, bwNames[settings.listenBw]);
+  p = FORMAT_String(p, " ");
 
     if(isNormalizationApplied){
-      len = sprintf(&String[pos], "N(%ux) ", GetStepsCount());
-      pos += len;
+      p = FORMAT_String(p, "N(");
+      p = FORMAT_Unsigned(p, GetStepsCount(), 0, ' ');
+      p = FORMAT_String(p, "x) ");
     }
     else {
-      len = sprintf(&String[pos], "%ux ", GetStepsCount());
-      pos += len;
+      p = FORMAT_Unsigned(p, GetStepsCount(), 0, ' ');
+      p = FORMAT_String(p, "x ");
     }
-    len = sprintf(&String[pos],"%dms ", DelayRssi);
-    pos += len;
+    p = FORMAT_Unsigned(p, DelayRssi, 0, ' ');
+    p = FORMAT_String(p, "ms ");
     
   if (appMode==CHANNEL_MODE)
     {
-      len = sprintf(&String[pos], "M%i ", channel+1);
-      pos += len;      
+      p = FORMAT_String(p, "M");
+      p = FORMAT_Signed(p, channel+1, 0, 0);
+      p = FORMAT_String(p, " ");
     }
     else
-    {if (scanInfo.scanStep<2500)
-      {len = sprintf(&String[pos],"%u.%02uk", scanInfo.scanStep / 100, scanInfo.scanStep % 100);
-      pos += len;}
-    else {len = sprintf(&String[pos],"%uk", scanInfo.scanStep / 100, scanInfo.scanStep % 100);pos += len;}
+    {p = FORMAT_Unsigned(p, scanInfo.scanStep / 100, 0, ' ');
+    if (scanInfo.scanStep<2500)
+      {p = FORMAT_String(p, ".");
+      p = FORMAT_Unsigned(p, scanInfo.scanStep % 100, 2, '0');}
+    p = FORMAT_String(p, "k");
     }
-  if(WaitSpectrum>0 && WaitSpectrum <61000){len = sprintf(&String[pos],"%d", WaitSpectrum/1000);pos += len;}
-  else if(WaitSpectrum > 61000){len = sprintf(&String[pos],"oo");pos += len;} //locked
+  if (ShowOccupancy) {
+    p = FORMAT_String(p, " OCC");
+    uint8_t suggested = CountBlacklistSuggestions();
+    if (suggested) {p = FORMAT_String(p, " BL"); p = FORMAT_Unsigned(p, suggested, 0, ' ');}
+  }
+  if(WaitSpectrum>0 && WaitSpectrum <61000){p = FORMAT_Unsigned(p, WaitSpectrum/1000, 0, ' ');}
+  else if(WaitSpectrum > 61000){p = FORMAT_String(p, "oo");} //locked
 
   GUI_DisplaySmallest(String, 0, 1, true,true);
   BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[gBatteryCheckCounter++ % 4]);
@@ -1013,7 +1226,8 @@ static void DrawStatus() {
 }
 
 static void formatHistory(char *buf, uint8_t index, int channel, uint32_t freq) {
-    char freqStr[16];
+    char line[40];
+    char *p = line;
     
     // Handle 833Hz stepping adjustment if needed
     if(channel == -1 && GetScanStep() == 833) {
@@ -1022,24 +1236,23 @@ static void formatHistory(char *buf, uint8_t index, int channel, uint32_t freq)
             freq = base + (chno * 833) + (chno == 3);
         }
 
-    // Format frequency string
-    snprintf(freqStr, sizeof(freqStr), "%u.%05u", freq/100000, freq%100000);
-    RemoveTrailZeros(freqStr);
-
+    // "index:name(count)" for a known channel, "index:frequency(count)" otherwise
+    p = FORMAT_Unsigned(p, index, 0, ' ');
+    p = FORMAT_String(p, ":");
     if(channel != -1) {
-        // Known channel format
-        snprintf(buf, 19, "%u:%s(%u)", 
-                index, 
-                gMR_ChannelFrequencyAttributes[channel].Name,
-                freqCount[index]);
-                
+        char name[sizeof(gMR_ChannelFrequencyAttributes[0].Name) + 1] = {0};
+        memcpy(name, gMR_ChannelFrequencyAttributes[channel].Name, sizeof(gMR_ChannelFrequencyAttributes[0].Name));
+        p = FORMAT_String(p, name);
     } else {
-        // Unknown channel format
-        snprintf(buf, 19, "%u:%s(%u)", 
-                index,
-                freqStr,
-                freqCount[index]);
-        }
+        p = FORMAT_Frequency(p, freq, true);
+    }
+    p = FORMAT_String(p, "(");
+    p = FORMAT_Unsigned(p, freqCount[index], 0, ' ');
+    FORMAT_String(p, ")");
+
+    // same cut as the snprintf it replaces
+    strncpy(buf, line, 18);
+    buf[18] = '\0';
 }
 
 static void DrawF(uint32_t f) {
@@ -1060,8 +1273,7 @@ static void DrawF(uint32_t f) {
         f = base + (chno * 833) + (chno == 3);
     }
     char freqStr[16];
-    sprintf(freqStr, "%u.%05u", f / 100000, f % 100000);
-    RemoveTrailZeros(freqStr);
+    FORMAT_Frequency(freqStr, f, true);
 
     // --- CTCSS/DCS Detection ---
     if (refresh == 0) {
@@ -1070,11 +1282,15 @@ static void DrawF(uint32_t f) {
         if (scanResult == BK4819_CSS_RESULT_CDCSS) {
             Code = DCS_GetCdcssCode(cdcssFreq);
             refresh = 30;
-            if (Code != 0xFF) sprintf(StringCode, "D%03oN", DCS_Options[Code]);
+            if (Code != 0xFF) {
+                sprintf(StringCode, "D%03oN", DCS_Options[Code]);
+                EVENTLOG_SetCode(EVENTLOG_CODE_DCS | Code);
+            }
         } else if (scanResult == BK4819_CSS_RESULT_CTCSS) {
             Code = DCS_GetCtcssCode(ctcssFreq);
             refresh = 30;
             sprintf(StringCode, "%u.%uHz", CTCSS_Options[Code] / 10, CTCSS_Options[Code] % 10);
+            EVENTLOG_SetCode(Code);
         }
     }
     refresh--;
@@ -1112,7 +1328,10 @@ static void DrawF(uint32_t f) {
     
     // --- Default: Band Name or Scan List (Top Line) ---
     if (appMode == SCAN_BAND_MODE && !isListening) {
-        snprintf(line1, sizeof(line1), "B%u:%s", bl+1, BParams[bl].BandName);
+        if (ShowOccupancy)
+            snprintf(line1, sizeof(line1), "B%u:%u%% %s", bl+1, OccupancyPercent(bandOccupancy[bl]), BParams[bl].BandName);
+        else
+            snprintf(line1, sizeof(line1), "B%u:%s", bl+1, BParams[bl].BandName);
     } else if (appMode == CHANNEL_MODE && !isListening && currentState == SPECTRUM) {
               if (enabledCount > 0) {
                 snprintf(line1, sizeof(line1), "SL %s", enabledLists);
@@ -1222,69 +1441,56 @@ static void DrawNums() {
 
   if (appMode==CHANNEL_MODE) 
   {
-    sprintf(String, "M:%d", scanChannel[0]+1);
+    FORMAT_Unsigned(FORMAT_String(String, "M:"), scanChannel[0]+1, 0, ' ');
     GUI_DisplaySmallest(String, 0, Bottom_print, false, true);
 
-    sprintf(String, "M:%d", scanChannel[GetStepsCount()-1]+1);
+    FORMAT_Unsigned(FORMAT_String(String, "M:"), scanChannel[GetStepsCount()-1]+1, 0, ' ');
     GUI_DisplaySmallest(String, 108, Bottom_print, false, true);
   }
   if(appMode==FREQUENCY_MODE){ 
-    sprintf(String, "%u.%05u", GetFStart() / 100000, GetFStart() % 100000);
+    FORMAT_Frequency(String, GetFStart(), false);
     GUI_DisplaySmallest(String, 0, Bottom_print, false, true);
 
-    sprintf(String, "%u.%05u", GetFEnd() / 100000, GetFEnd() % 100000);
+    FORMAT_Frequency(String, GetFEnd(), false);
     GUI_DisplaySmallest(String, 90, Bottom_print, false, true);
   }
 
   if(appMode==SCAN_RANGE_MODE || appMode==SCAN_BAND_MODE){
-    sprintf(String, "%u.%05u", gScanRangeStart / 100000, gScanRangeStart % 100000); //Robby69 was %u.%05u
+    FORMAT_Frequency(String, gScanRangeStart, false);
     GUI_DisplaySmallest(String, 0, Bottom_print, false, true);
  
-    sprintf(String, "%u.%05u", gScanRangeStop / 100000, gScanRangeStop % 100000); //Robby69 was %u.%05u
+    FORMAT_Frequency(String, gScanRangeStop, false);
     GUI_DisplaySmallest(String, 90, Bottom_print, false, true);
   }
   
   if(SquelchBarKeyMode ==0 )
-  { sprintf(String, "HL");
-    GUI_DisplaySmallest(String, 50, Bottom_print, false, true);
-  }
+    GUI_DisplaySmallest("HL", 50, Bottom_print, false, true);
   
   if(SquelchBarKeyMode ==1 )
-  { sprintf(String, "L");
-    GUI_DisplaySmallest(String, 50, Bottom_print, false, true);
-  }
+    GUI_DisplaySmallest("L", 50, Bottom_print, false, true);
   
   if(SquelchBarKeyMode ==2 )
-  { sprintf(String, "H");
-    GUI_DisplaySmallest(String, 50, Bottom_print, false, true);
-  }
+    GUI_DisplaySmallest("H", 50, Bottom_print, false, true);
 
-  if(isBlacklistApplied){
-    sprintf(String, "BL");
-    GUI_DisplaySmallest(String, 60, Bottom_print, false, true);
-  }
+  if(isBlacklistApplied)
+    GUI_DisplaySmallest("BL", 60, Bottom_print, false, true);
   if(saved_params) //Display saved for a while
-      {sprintf(String, "SA");
-      GUI_DisplaySmallest(String, 70, Bottom_print, false, true);
+      {GUI_DisplaySmallest("SA", 70, Bottom_print, false, true);
       saved_params = false;
       }
   
-  if(AutoTriggerLevelbandsMode && appMode == SCAN_BAND_MODE){ //Display status
-    sprintf(String, "AB");
-    GUI_DisplaySmallest(String, 80, Bottom_print, false, true);
-    }
+  if(AutoTriggerLevelbandsMode && appMode == SCAN_BAND_MODE) //Display status
+    GUI_DisplaySmallest("AB", 80, Bottom_print, false, true);
 }
 
 static void DrawRssiTriggerLevel() {
   //if (settings.rssiTriggerLevel == RSSI_MAX_VALUE || monitorMode)
   //  return;
-  uint8_t y = Rssi2Y(settings.rssiTriggerLevel);
-  for (uint8_t x = 0; x < 128; x += 2) {
-    PutPixel(x, y, true);
-  }
+  if (ShowOccupancy)
+    return;
+  DrawDottedHLine(Rssi2Y(settings.rssiTriggerLevel), 2, true);
   if (ShowHistory) {
-  y = Rssi2Y(settings.rssiTriggerLevelH);
-  for (uint8_t x = 0; x < 128; x += 6) {PutPixel(x, y, true);}
+    DrawDottedHLine(Rssi2Y(settings.rssiTriggerLevelH), 6, true);
   }
 }
 
@@ -1304,6 +1510,7 @@ static void OnKeyDown(uint8_t key) {
     // NEW HANDLING: press of '4' key in CHANNEL_MODE
     if (appMode == CHANNEL_MODE && key == KEY_4 && currentState == SPECTRUM) {
         SetState(SCANLIST_SELECT);
+        BuildValidScanListIndices();
         scanListSelectedIndex = 0;
         scanListScrollOffset = 0;
         redrawScreen = true;
@@ -1344,6 +1551,7 @@ static void OnKeyDown(uint8_t key) {
                 if (bandListSelectedIndex < ARRAY_SIZE(BParams)) {
                     // Set the selected band as the only active one for scanning
                     settings.bandEnabled[bandListSelectedIndex] = !settings.bandEnabled[bandListSelectedIndex]; 
+                    ListView_RefreshItem(GetBandItemText, bandListSelectedIndex);
                     // Reset nextBandToScanIndex so InitScan starts from the selected one
                     nextBandToScanIndex = bandListSelectedIndex; 
                     bandListSelectedIndex++;
@@ -1354,6 +1562,7 @@ static void OnKeyDown(uint8_t key) {
                     // Set the selected band as the only active one for scanning
                     memset(settings.bandEnabled, 0, sizeof(settings.bandEnabled)); // Clear all flags
                     settings.bandEnabled[bandListSelectedIndex] = true; // Enable selected band
+                    ListView_RefreshAll();
                     
                     // Reset nextBandToScanIndex so InitScan starts from the selected one
                     nextBandToScanIndex = bandListSelectedIndex; 
@@ -1427,6 +1636,7 @@ static void OnKeyDown(uint8_t key) {
             case KEY_4: // Scan list selection
                 //ToggleScanList(scanListSelectedIndex, 0);
 				ToggleScanList(validScanListIndices[scanListSelectedIndex], 0);
+                ListView_RefreshItem(GetFilteredScanListText, scanListSelectedIndex);
 
                 if (scanListSelectedIndex < validScanListCount - 1) {
                       scanListSelectedIndex++;
@@ -1436,6 +1646,7 @@ static void OnKeyDown(uint8_t key) {
                 break;
             case KEY_5: // Scan list selection
                 ToggleScanList(validScanListIndices[scanListSelectedIndex], 1);
+                ListView_RefreshAll();
                  redrawScreen = true;
                 break;
 				
@@ -1531,6 +1742,9 @@ static void OnKeyDown(uint8_t key) {
 #ifdef ENABLE_NINJA
                   else if (parametersSelectedIndex == 2) RandomEmission = 1;
 #endif
+                  else if (parametersSelectedIndex == PARAMETER_FRAMERATE) {if (FrameRate < ARRAY_SIZE(frameTicks) - 1) FrameRate++;}
+                  else if (parametersSelectedIndex == PARAMETER_DISPLAY) {ShowOccupancy = true; redrawStatus = true;}
+                ListView_RefreshItem(GetParametersText, parametersSelectedIndex);
                 break;
           case KEY_1:   
                 if (parametersSelectedIndex == 0){
@@ -1544,6 +1758,9 @@ static void OnKeyDown(uint8_t key) {
 #ifdef ENABLE_NINJA
                     else if (parametersSelectedIndex == 2) RandomEmission = 0;
 #endif
+                    else if (parametersSelectedIndex == PARAMETER_FRAMERATE) {if (FrameRate > 0) FrameRate--;}
+                    else if (parametersSelectedIndex == PARAMETER_DISPLAY) {ShowOccupancy = false; redrawStatus = true;}
+                ListView_RefreshItem(GetParametersText, parametersSelectedIndex);
                 break;
         case KEY_EXIT: // Exit parameters menu to previous menu/state
           SetState(previousState);
@@ -1604,6 +1821,7 @@ if ((ShowHistory) && (kbd.counter == 16)) { //(long press):
     memset(&freqCount[1], 0, sizeof(freqCount) - sizeof(freqCount[0]));
     indexFd = 1;
     indexFs = 1;
+    historyCount = 0;
     
     // DODAJ TO: Reset receiving state when history is cleared
     ResetReceivingState();
@@ -1652,13 +1870,7 @@ break;
   case KEY_DOWN:
     redrawScreen = true;
     if (currentState == HISTORY_LIST) {
-        int numValidEntries = 0;
-        for(int k=0; k < FMaxNumb; ++k) {
-            if (freqHistory[k] != 0) {
-                numValidEntries++;
-            }
-        }
-        if (historyListIndex < numValidEntries-1) { 
+        if (historyListIndex + 1 < historyCount) { 
           historyListIndex++;
           if (historyListIndex >= historyScrollOffset + MAX_VISIBLE_LINES) {
                 historyScrollOffset = historyListIndex - MAX_VISIBLE_LINES + 1;
@@ -1682,7 +1894,8 @@ break;
     #ifdef ENABLE_SCREENSHOT
       getScreenShot();
     #endif
-    Blacklist();
+    if (ShowOccupancy && CountBlacklistSuggestions()) BlacklistBusyBins();
+    else Blacklist();
     WaitSpectrum = 0; //don't wait if this frequency not interesting
     break;
   
@@ -1714,20 +1927,13 @@ break;
   case KEY_MENU:
   if (kbd.counter == 3) SaveSettings(); // short press
   else {
-        int validCount = 0;
-        
-        for (int k = 1; k <= FMaxNumb; ++k) {
-            if (freqHistory[k] != 0) {
-                validCount++;
-            }
-        }
         if (currentState == HISTORY_LIST) {
           uint32_t selectedFreq = freqHistory[historyListIndex+1];
           currentFreq = selectedFreq;
           fMeasure = selectedFreq;
           SetF(fMeasure);
         }
-        else if (historyListIndex < validCount && ShowHistory) {
+        else if (historyListIndex < historyCount && ShowHistory) {
             uint32_t selectedFreq = freqHistory[indexFd];
             currentFreq = selectedFreq;
             fMeasure = selectedFreq;
@@ -1888,13 +2094,6 @@ static void RenderSpectrum() {
 
 
 static void RenderStill() {
-  if (WaitSpectrum > 0 && WaitSpectrum <61000) { //65000 locks still mode
-      WaitSpectrum-=20;
-      redrawStatus = true;
-      SYSTEM_DelayMs(1);
-      if (WaitSpectrum ==0) SetState(SPECTRUM); 
-      }
-  
   DrawF(fMeasure);
   
   const uint8_t METER_PAD_LEFT = 3;
@@ -1919,17 +2118,10 @@ static void RenderStill() {
   sLevelAttributes sLevelAtt;
   sLevelAtt = GetSLevelAttributes(scanInfo.rssi, fMeasure);
 
-  if(sLevelAtt.over > 0)
-  {
-    sprintf(String, "S%2d+%2d", sLevelAtt.sLevel, sLevelAtt.over);
-  }
-  else
-  {
-    sprintf(String, "S%2d", sLevelAtt.sLevel);
-  }
+  FORMAT_SLevel(String, sLevelAtt.sLevel, sLevelAtt.over);
 
   GUI_DisplaySmallest(String, 4, 25, false, true);
-  sprintf(String, "%d dBm", sLevelAtt.dBmRssi);
+  FORMAT_String(FORMAT_Signed(String, sLevelAtt.dBmRssi, 0, 0), " dBm");
   GUI_DisplaySmallest(String, 40, 25, false, true);
 
   if (!monitorMode) {
@@ -1964,7 +2156,9 @@ static void RenderStill() {
 }
 
 static void Render() {
-  memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+  // the lists keep their lines between frames
+  if (currentState == SPECTRUM || currentState == FREQ_INPUT || currentState == STILL)
+    memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
 
   switch (currentState) {
   case SPECTRUM:
@@ -1997,7 +2191,7 @@ static void Render() {
 #endif // ENABLE_SCANLIST_SHOW_DETAIL
   }
 
-  ST7565_BlitFullScreen();
+  ST7565_BlitDirty();
 }
 
 bool HandleUserInput() {
@@ -2094,6 +2288,77 @@ static void NextScanStep() {
     }
 }
 
+// one frame per completed sweep, dropped if the TX ring is still busy with the previous one
+typedef struct {
+  uint16_t id;             // 0x0539
+  uint16_t size;
+  uint32_t fStart;         // 10Hz, 0 in channel mode
+  uint32_t fPeak;
+  uint16_t step;           // 10Hz between measurements
+  uint16_t measurements;   // bins cover measurements / bins steps each
+  uint16_t rssiPeak;
+  uint16_t trigger;
+  uint16_t triggerH;
+  uint16_t base;           // bin = base + (value << shift), blacklisted bins are 0
+  uint8_t  bins;
+  uint8_t  packing;        // UART_Telemetry_t
+  uint8_t  shift;
+  uint8_t  flags;          // bit0 over trigger, bit1 listening, bit2 channel mode
+  uint8_t  data[128];
+} SpectrumTelemetry;
+
+static void SendTelemetry() {
+  SpectrumTelemetry frame;
+  const UART_Telemetry_t packing = UART_GetTelemetry();
+  const uint8_t bins = scanInfo.measurementsCount < 128 ? scanInfo.measurementsCount : 128;
+  uint16_t rssiMin = RSSI_MAX_VALUE;
+  uint16_t rssiMax = 0;
+  uint8_t len;
+
+  if (packing == UART_TELEMETRY_OFF)
+    return;
+
+  for (uint8_t i = 0; i < bins; i++) {
+    const uint16_t rssi = rssiHistory[i];
+    if (rssi == 0 || rssi == RSSI_MAX_VALUE) continue;
+    if (rssi < rssiMin) rssiMin = rssi;
+    if (rssi > rssiMax) rssiMax = rssi;
+  }
+  if (rssiMin > rssiMax) rssiMin = rssiMax = 0;
+
+  memset(&frame, 0, sizeof(frame));
+  frame.id           = 0x0539;
+  frame.fStart       = appMode == CHANNEL_MODE ? 0 : scanInfo.f - scanInfo.i * scanInfo.scanStep;
+  frame.fPeak        = scanInfo.fPeak;
+  frame.step         = appMode == CHANNEL_MODE ? 0 : scanInfo.scanStep;
+  frame.measurements = scanInfo.measurementsCount;
+  frame.rssiPeak     = scanInfo.rssiMax;
+  frame.trigger      = settings.rssiTriggerLevel;
+  frame.triggerH     = settings.rssiTriggerLevelH;
+  frame.base         = rssiMin;
+  frame.bins         = bins;
+  frame.packing      = packing;
+  frame.flags        = (IsPeakOverLevel() ? 1 : 0) | (isListening ? 2 : 0) | (appMode == CHANNEL_MODE ? 4 : 0);
+
+  if (packing == UART_TELEMETRY_4BIT)
+    while (((rssiMax - rssiMin) >> frame.shift) > 15) frame.shift++;
+
+  for (uint8_t i = 0; i < bins; i++) {
+    const uint16_t rssi = rssiHistory[i];
+    uint16_t v = (rssi == 0 || rssi == RSSI_MAX_VALUE) ? 0 : (rssi - rssiMin) >> frame.shift;
+
+    if (packing == UART_TELEMETRY_4BIT)
+      frame.data[i >> 1] |= v << ((i & 1) * 4);
+    else
+      frame.data[i] = v > 255 ? 255 : v;
+  }
+
+  len = packing == UART_TELEMETRY_4BIT ? (bins + 1) / 2 : bins;
+  frame.size = offsetof(SpectrumTelemetry, data) - 4 + len;
+
+  UART_TrySendFrame(&frame, offsetof(SpectrumTelemetry, data) + len);
+}
+
 static void UpdateScan() {
   Scan();
   if (scanInfo.i < GetStepsCount()) {
@@ -2104,7 +2369,9 @@ static void UpdateScan() {
     memset(&rssiHistory[scanInfo.measurementsCount], 0, sizeof(rssiHistory) - scanInfo.measurementsCount*sizeof(rssiHistory[0]));
   redrawScreen = true;
   preventKeypress = false;
+  UpdateBandOccupancy();
   UpdatePeakInfo();
+  SendTelemetry();
   if (IsPeakOverLevel()) {
     // Signal detected or resumed
     ToggleRX(true);
@@ -2132,8 +2399,13 @@ static void UpdateListening() {
     //SpectrumDelay = 0;
   }
   if (listenT) {
-    listenT--;
-    SYSTEM_DelayMs(1);
+    // sleep through the tick, or keep the UART and LCD going and only count it
+    if (!UART_IsBusy() && UART_IsTxIdle() && !ST7565_IsBusy())
+      SCHEDULER_WaitForTick();
+    if (SCHEDULER_GetTick() != listenTick) {
+      listenTick = SCHEDULER_GetTick();
+      listenT--;
+    }
     return;
   }
 
@@ -2151,6 +2423,7 @@ static void UpdateListening() {
 
   if ((IsPeakOverLevel() || monitorMode) ) {
     listenT = SQUELCH_OFF_DELAY;
+    listenTick = SCHEDULER_GetTick();
     return;
   }
 
@@ -2159,7 +2432,43 @@ static void UpdateListening() {
   ResetScanStats();
 }
 
+// true once per frame period, the sweeps and the listening keep going in between
+static bool FrameDue() {
+  static uint32_t lastFrameTick;
+  const uint32_t now = SCHEDULER_GetTick();
+
+  if (now - lastFrameTick < frameTicks[FrameRate])
+    return false;
+  lastFrameTick = now;
+  return true;
+}
+
+// the still mode gives up after SpectrumDelay ms without a signal, 65000 locks it
+static void UpdateWaitSpectrum() {
+  static uint32_t lastTick;
+  const uint32_t now = SCHEDULER_GetTick();
+  // capped, lastTick is stale when the spectrum is entered again
+  const uint32_t elapsed = (now - lastTick < 5) ? (now - lastTick) * 10 : 50;
+
+  lastTick = now;
+  if (currentState != STILL || WaitSpectrum == 0 || WaitSpectrum >= 61000 || elapsed == 0)
+    return;
+
+  WaitSpectrum = (elapsed < WaitSpectrum) ? WaitSpectrum - elapsed : 0;
+  redrawStatus = true;
+  if (WaitSpectrum == 0) SetState(SPECTRUM);
+}
+
 static void Tick() {
+  static uint16_t snapshotCountdown_500ms;
+
+  UART_Service();
+  ST7565_Poll();
+  // the radio belongs to the remote sweep until SPECTRUM_RemoteSweepEnd
+  if (remoteSweep)
+    return;
+  UpdateWaitSpectrum();
+
   if (gNextTimeslice_500ms) {
     if (gBacklightCountdown > 0)
       if (--gBacklightCountdown == 0)
@@ -2167,6 +2476,11 @@ static void Tick() {
 					BACKLIGHT_TurnOff();   // turn backlight off
     gNextTimeslice_500ms = false;
 
+    // 5 min, the radio is often switched off without leaving the spectrum
+    if (++snapshotCountdown_500ms >= 600 && !isListening) {
+      snapshotCountdown_500ms = 0;
+      SaveSnapshot();
+    }
 
     // if a lot of steps then it takes long time
     // we don't want to wait for whole scan
@@ -2185,7 +2499,7 @@ static void Tick() {
   }
 
   if (!preventKeypress) {
-    HandleUserInput();
+    PROFILE(PROFILER_SPECTRUM_INPUT, HandleUserInput());
   }
   if (newScanStart) {
     ResetPeak();
@@ -2193,22 +2507,25 @@ static void Tick() {
     newScanStart = false;
   }
   if (isListening && currentState != FREQ_INPUT) {
-    UpdateListening();
+    PROFILE(PROFILER_SPECTRUM_SCAN, UpdateListening());
   } else {
     if (currentState == SPECTRUM) {
-      UpdateScan();
+      PROFILE(PROFILER_SPECTRUM_SCAN, UpdateScan());
     } else if (currentState == STILL) {
-      UpdateStill();
+      PROFILE(PROFILER_SPECTRUM_SCAN, UpdateStill());
     }
   }
+  // the last frame is still going out by DMA, draw the next one after it
+  if (ST7565_IsBusy())
+    return;
   if (redrawStatus || ++statuslineUpdateTimer > 4096) {
     latestScanListName[0] = '\0';
-    RenderStatus();
+    PROFILE(PROFILER_SPECTRUM_RENDER, RenderStatus());
     redrawStatus = false;
     statuslineUpdateTimer = 0;
   }
-  if (redrawScreen) {
-    Render();
+  if (redrawScreen && FrameDue()) {
+    PROFILE(PROFILER_SPECTRUM_RENDER, Render());
     redrawScreen = false;
   }
 }
@@ -2222,8 +2539,9 @@ void APP_RunSpectrum(uint8_t Spectrum_state) {
   if (Spectrum_state == 3) mode = SCAN_RANGE_MODE ;
   if (Spectrum_state == 2) mode = SCAN_BAND_MODE ;
   if (Spectrum_state == 1) mode = CHANNEL_MODE ;
-  EEPROM_WriteBuffer(0x1D00, &Spectrum_state, 1);
+  JOURNAL_Write(JOURNAL_KEY_SPECTRUM, &Spectrum_state);
   LoadSettings();
+  EVENTLOG_Load();
   appMode = mode;
   ResetModifiers();
   if (appMode==CHANNEL_MODE)LoadValidMemoryChannels();
@@ -2265,6 +2583,7 @@ void APP_RunSpectrum(uint8_t Spectrum_state) {
   for (int i = 0; i < 128; ++i) {
     rssiHistory[i] = 0;
   }
+  LoadSnapshot();
 
   isInitialized = true;
 
@@ -2273,6 +2592,42 @@ void APP_RunSpectrum(uint8_t Spectrum_state) {
   }
 }
 
+// Remote sweeps (UART 0x053B) share the tuning and RSSI path of the scan.
+// They run on top of the main screen or in place of the spectrum scan steps.
+void SPECTRUM_RemoteSweepBegin(ModulationMode_t modulation) {
+  if (!isInitialized)
+    BackupRegisters();
+  remoteSweep = true;
+  remoteSweepF = fMeasure;
+  ResetInterrupts();
+  ToggleAFDAC(false);
+  ToggleAFBit(false);
+  RADIO_SetModulation(modulation);
+}
+
+void SPECTRUM_RemoteSweepMeasure(uint32_t f, uint8_t dwellMs, SpectrumSample *sample) {
+  SetF(f);
+  BK4819_ReadRegister(0x63);
+  SYSTICK_DelayUs((dwellMs ? dwellMs : DelayRssi) * 1000);
+  sample->rssi   = BK4819_GetRSSI();
+  sample->noise  = BK4819_ReadRegister(BK4819_REG_65) & 0x007F;
+  sample->glitch = BK4819_GetGlitchIndicator();
+}
+
+void SPECTRUM_RemoteSweepEnd(void) {
+  remoteSweep = false;
+  if (isInitialized) {
+    // the scan picks up where it was, on its own modulation and frequency
+    RADIO_SetModulation(settings.modulationType);
+    RelaunchScan();
+    if (currentState == STILL)
+      SetF(remoteSweepF);
+    return;
+  }
+  RestoreRegisters();
+  gVfoConfigureMode = VFO_CONFIGURE;
+}
+
 void LoadValidMemoryChannels(void)
   {
     memset(scanChannel,0,sizeof(scanChannel));
@@ -2367,6 +2722,7 @@ typedef struct {
     uint8_t rssiTriggerLevel;
     uint8_t rssiTriggerLevelH;
     int8_t dbMax;
+    uint8_t FrameRate;              // index + 1, 0 on older EEPROM images
     uint32_t RangeStart;
     uint32_t RangeStop;
 } SettingsEEPROM;
@@ -2392,6 +2748,7 @@ void LoadSettings()
     if (DelayRssi > 12) DelayRssi =12;
     if (RandomEmission > 1) RandomEmission =0;
     RandomEmission = eepromData.RandomEmission;
+    FrameRate = (eepromData.FrameRate == 0 || eepromData.FrameRate > ARRAY_SIZE(frameTicks)) ? 3 : eepromData.FrameRate - 1;
     
     
     validScanListCount = 0;
@@ -2414,6 +2771,7 @@ void SaveSettings()
   eepromData.dbMax = settings.dbMax;
   eepromData.DelayRssi = DelayRssi;
   eepromData.RandomEmission = RandomEmission;
+  eepromData.FrameRate = FrameRate + 1;
   for (int i = 0; i < 32; i++) { eepromData.BPRssiTriggerLevel[i] = BPRssiTriggerLevel[i];}
   for (int i = 0; i < 32; i++) {if (settings.bandEnabled[i]) eepromData.bandListFlags |= (1 << i);}
   // Write in 8-byte chunks
@@ -2423,24 +2781,118 @@ void SaveSettings()
 }
 
 
-// Helper functions for history list
-static uint8_t CountValidHistoryItems() {
-    uint8_t count = 0;
+// Warm start: what the last sweeps learned, so the first sweep after a
+// power cycle does not start blind. 56 bytes at 0x1D88, up to the journal.
+#define SNAPSHOT_ADDR 0x1D88
+
+typedef struct {
+  uint32_t start;          // sweep the bins belong to
+  uint16_t step;
+  uint16_t count;
+  uint8_t  mode;           // Mode, 0xFF: nothing saved
+  uint8_t  flags;          // bit 0: normalization applied
+  uint16_t blacklist[7];   // newest blacklisted scan indexes, 0: unused
+  uint8_t  floor[16];      // raw noise floor / 2 for each 1/16 of the bins
+  uint32_t history[4];     // most counted frequencies, count in the top 5 bits
+} SpectrumSnapshot;
+
+static uint8_t SnapshotBins() {
+  return (sweepCount > 128) ? 128 : sweepCount;
+}
+
+static void SaveSnapshot() {
+  SpectrumSnapshot snap;
+  const uint8_t bins = SnapshotBins();
+
+  memset(&snap, 0, sizeof(snap));
+  snap.start = sweepStart;
+  snap.step = sweepStep;
+  snap.count = sweepCount;
+  snap.mode = appMode;
+  snap.flags = isNormalizationApplied;
+
+  for (uint8_t k = 0; k < ARRAY_SIZE(snap.blacklist); k++)
+    snap.blacklist[k] = blacklistFreqs[(uint8_t)(blacklistFreqsIdx - 1 - k) % ARRAY_SIZE(blacklistFreqs)];
+
+  // noise floor: lowest bin of each segment, without the normalization
+  memset(snap.floor, 0xFF, sizeof(snap.floor));
+  for (uint8_t i = 0; i < bins; i++) {
+    if (rssiHistory[i] == 0 || rssiHistory[i] == RSSI_MAX_VALUE || rssiHistory[i] < gainOffset[i])
+      continue;
+    uint8_t seg = i * 16 / bins;
+    uint16_t raw = (rssiHistory[i] - gainOffset[i]) / 2;
+    if (raw < snap.floor[seg])
+      snap.floor[seg] = raw;
+  }
+  for (uint8_t seg = 0; seg < ARRAY_SIZE(snap.floor); seg++)
+    if (snap.floor[seg] == 0xFF) snap.floor[seg] = 0;
+
+  // top of the history, highest count first
+  for (uint8_t k = 0; k < ARRAY_SIZE(snap.history); k++) {
+    uint8_t best = 0;
     for (uint8_t i = 1; i <= FMaxNumb; i++) {
-        if (freqHistory[i] != 0) count++;
+      bool taken = false;
+      for (uint8_t j = 0; j < k; j++)
+        taken |= (snap.history[j] & 0x07FFFFFF) == freqHistory[i];
+      if (freqHistory[i] && !taken && (!best || freqCount[i] > freqCount[best]))
+        best = i;
     }
-    return count;
+    if (!best)
+      break;
+    snap.history[k] = freqHistory[best] | (uint32_t)(freqCount[best] > 31 ? 31 : freqCount[best]) << 27;
+  }
+
+  for (uint8_t addr = 0; addr < sizeof(snap); addr += 8)
+    EEPROM_WriteBuffer(SNAPSHOT_ADDR + addr, ((uint8_t *)&snap) + addr, true);
 }
 
-static uint8_t GetHistoryRealIndex(uint8_t displayIndex) {
-    uint8_t count = 0;
-    for (uint8_t i = 1; i <= FMaxNumb; i++) {
-        if (freqHistory[i] != 0) {
-            if (count == displayIndex) return i;
-            count++;
-        }
+// the bins are only restored into the same sweep, the history always
+static void LoadSnapshot() {
+  SpectrumSnapshot snap;
+  const uint8_t bins = SnapshotBins();
+
+  EEPROM_ReadBuffer(SNAPSHOT_ADDR, &snap, sizeof(snap));
+  if (snap.mode != appMode)
+    return;
+
+  if (indexFs == 1 && freqHistory[1] == 0) {
+    for (uint8_t k = 0; k < ARRAY_SIZE(snap.history) && snap.history[k]; k++) {
+      freqHistory[indexFs] = snap.history[k] & 0x07FFFFFF;
+      freqCount[indexFs++] = snap.history[k] >> 27;
     }
-    return 1; // Fallback
+    if (indexFs > 1) indexFd = 1;
+    historyCount = indexFs - 1;
+  }
+
+  if (snap.start != sweepStart || snap.step != sweepStep || snap.count != sweepCount)
+    return;
+
+  uint8_t max = 0;
+  for (uint8_t seg = 0; seg < ARRAY_SIZE(snap.floor); seg++)
+    if (snap.floor[seg] > max) max = snap.floor[seg];
+
+  for (uint8_t i = 0; i < bins; i++) {
+    uint8_t raw = snap.floor[i * 16 / bins];
+    uint16_t offset = (snap.flags & 1) ? (max - raw) * 2 : 0;
+    gainOffset[i] = (offset > 255) ? 255 : offset;
+    rssiHistory[i] = raw * 2 + gainOffset[i];
+  }
+  isNormalizationApplied = snap.flags & 1;
+
+  for (uint8_t k = 0; k < ARRAY_SIZE(snap.blacklist); k++) {
+    uint16_t idx = snap.blacklist[k];
+    if (idx == 0 || IsBlacklisted(idx))
+      continue;
+    blacklistFreqs[blacklistFreqsIdx++ % ARRAY_SIZE(blacklistFreqs)] = idx;
+    if (idx < ARRAY_SIZE(rssiHistory)) rssiHistory[idx] = RSSI_MAX_VALUE;
+    isBlacklistApplied = true;
+  }
+}
+
+// Entries fill freqHistory[1..historyCount] in order and are only cleared all
+// together, the list index of an entry is its slot - 1.
+static uint8_t GetHistoryRealIndex(uint8_t displayIndex) {
+    return displayIndex + 1;
 }
 
 static bool GetScanListLabel(uint8_t scanListIndex, char* bufferOut) {
@@ -2458,15 +2910,18 @@ static bool GetScanListLabel(uint8_t scanListIndex, char* bufferOut) {
     return false; // Aucun canal associé à cette scanlist
 }
 
+// the channel attributes do not change inside the spectrum, built once when the
+// scanlist menu is opened
 static void BuildValidScanListIndices() {
-    uint8_t ScanListCount = 0;
+    uint16_t used = 0;
+    for (uint8_t i = 0; i < 200; i++) {
+        const uint8_t sl = gMR_ChannelAttributes[i].scanlist;
+        if (sl >= 1 && sl <= 15) used |= 1u << (sl - 1);
+    }
+    validScanListCount = 0;
     for (uint8_t i = 0; i < 15; i++) {
-        char tempName[17];
-        if (GetScanListLabel(i, tempName)) {
-            validScanListIndices[ScanListCount++] = i;
-        }
+        if (used & (1u << i)) validScanListIndices[validScanListCount++] = i;
     }
-    validScanListCount = ScanListCount; // <-- KLUCZOWE!
 }
 
 
@@ -2484,6 +2939,8 @@ static void GetParametersText(uint8_t index, char *buffer) {
 #ifdef ENABLE_NINJA
   if (index == 2) sprintf(buffer, "Mode Ninja: %s", RandomEmission ? "ON" : "OFF");
 #endif
+  if (index == PARAMETER_FRAMERATE) sprintf(buffer, "Frame rate: %u fps", 100 / frameTicks[FrameRate]);
+  if (index == PARAMETER_DISPLAY) sprintf(buffer, "Display: %s", ShowOccupancy ? "Occupancy" : "RSSI");
   
   
  }
@@ -2521,56 +2978,155 @@ static void GetHistoryItemText(uint8_t index, char* buffer) {
     }
 }
 
-static void RenderList(const char* title, uint8_t numItems, uint8_t selectedIndex, uint8_t scrollOffset,
-                      void (*getItemText)(uint8_t index, char* buffer)) {
-    // Clear display buffer
+// Lines 1..MAX_VISIBLE_LINES below the title are kept between frames. Each one
+// caches its text, moving the cursor only redraws the lines that gain or lose
+// the marker and a scroll moves the lines that stay visible instead of asking
+// getItemText for them again.
+static void ListView_Invalidate() {
+  listView.getItemText = NULL;
+}
+
+// the text of an item changed, fetched again if it is on screen
+static void ListView_RefreshItem(ListItemText_t getItemText, uint8_t index) {
+  const uint8_t lines = listView.linesPerItem;
+
+  if (listView.getItemText != getItemText || index < listView.scrollOffset)
+    return;
+  index -= listView.scrollOffset;
+  if (index < MAX_VISIBLE_LINES / lines)
+    listView.staleLines |= ((1u << lines) - 1) << (index * lines);
+}
+
+static void ListView_RefreshAll() {
+  listView.staleLines = LIST_ALL_LINES;
+}
+
+// marks the lines of the items from first on, relative to the current scroll
+static void MarkItemsStale(uint8_t first) {
+  if (first < listView.scrollOffset)
+    first = listView.scrollOffset;
+  first = (first - listView.scrollOffset) * listView.linesPerItem;
+  if (first < MAX_VISIBLE_LINES)
+    listView.staleLines |= LIST_ALL_LINES & ~((1u << first) - 1);
+}
+
+static void MarkItemRedraw(uint8_t *pRedraw, uint8_t index) {
+  const uint8_t lines = listView.linesPerItem;
+
+  if (index < listView.scrollOffset)
+    return;
+  index -= listView.scrollOffset;
+  if (index < MAX_VISIBLE_LINES / lines)
+    *pRedraw |= ((1u << lines) - 1) << (index * lines);
+}
+
+static void RenderListView(const char *title, uint8_t numItems, uint8_t selectedIndex, uint8_t scrollOffset,
+                           ListItemText_t getItemText, uint8_t linesPerItem) {
+  const uint8_t visibleItems = MAX_VISIBLE_LINES / linesPerItem;
+  uint8_t redraw = 0;   // bit per line
+
+  if (numItems <= visibleItems) {
+    scrollOffset = 0;
+  } else if (selectedIndex < scrollOffset) {
+    scrollOffset = selectedIndex;
+  } else if (selectedIndex >= scrollOffset + visibleItems) {
+    scrollOffset = selectedIndex - visibleItems + 1;
+  }
+
+  if (listView.getItemText != getItemText || listView.linesPerItem != linesPerItem) {
     memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
-    
-    // Draw title - wyrównany do lewej dla maksymalnego wykorzystania miejsca
+    listView.getItemText = getItemText;
+    listView.linesPerItem = linesPerItem;
+    listView.scrollOffset = scrollOffset;
+    listView.title[0] = '\0';
+    listView.staleLines = LIST_ALL_LINES;
+  } else {
+    const int shift = ((int)scrollOffset - listView.scrollOffset) * linesPerItem;
+
+    if (shift >= MAX_VISIBLE_LINES || shift <= -MAX_VISIBLE_LINES) {
+      listView.staleLines = LIST_ALL_LINES;
+    } else if (shift > 0) {
+      const uint8_t keep = MAX_VISIBLE_LINES - shift;
+      memmove(listView.text[0], listView.text[shift], keep * sizeof(listView.text[0]));
+      memmove(gFrameBuffer[1], gFrameBuffer[1 + shift], keep * sizeof(gFrameBuffer[0]));
+      listView.staleLines = (listView.staleLines >> shift) | (LIST_ALL_LINES & ~((1u << keep) - 1));
+    } else if (shift < 0) {
+      const uint8_t keep = MAX_VISIBLE_LINES + shift;
+      memmove(listView.text[-shift], listView.text[0], keep * sizeof(listView.text[0]));
+      memmove(gFrameBuffer[1 - shift], gFrameBuffer[1], keep * sizeof(gFrameBuffer[0]));
+      listView.staleLines = ((listView.staleLines << -shift) | ((1u << -shift) - 1)) & LIST_ALL_LINES;
+    }
+    listView.scrollOffset = scrollOffset;
+
+    if (numItems != listView.numItems)
+      MarkItemsStale(MIN(numItems, listView.numItems));
+    if (selectedIndex != listView.selected) {
+      MarkItemRedraw(&redraw, listView.selected);
+      MarkItemRedraw(&redraw, selectedIndex);
+    }
+  }
+  listView.numItems = numItems;
+  listView.selected = selectedIndex;
+
+  if (strcmp(listView.title, title) != 0) {
+    memset(gFrameBuffer[0], 0, sizeof(gFrameBuffer[0]));
     UI_PrintStringSmallBold(title, 1, LCD_WIDTH - 1, 0);
-    // List parameters for UI_PrintStringSmall (lines 1-7 available)
-    const uint8_t FIRST_ITEM_LINE = 1;  // Start from line 1 (line 0 is title)
-    const uint8_t MAX_LINES = 6;        // Lines 1-7 available for items
-    
-    // Adjust scroll offset if needed
-    if (numItems <= MAX_LINES) {
-        scrollOffset = 0;
-    } else if (selectedIndex < scrollOffset) {
-        scrollOffset = selectedIndex;
-    } else if (selectedIndex >= scrollOffset + MAX_LINES) {
-        scrollOffset = selectedIndex - MAX_LINES + 1;
+    strncpy(listView.title, title, sizeof(listView.title) - 1);
+    listView.title[sizeof(listView.title) - 1] = '\0';
+  }
+
+  for (uint8_t i = 0; i < visibleItems; i++) {
+    const uint8_t first = i * linesPerItem;
+    const uint8_t mask = ((1u << linesPerItem) - 1) << first;
+    const uint8_t itemIndex = scrollOffset + i;
+    char itemText[32] = "";
+
+    if (!(listView.staleLines & mask))
+      continue;
+
+    // two line items come as "first\nsecond"
+    if (itemIndex < numItems)
+      getItemText(itemIndex, itemText);
+    const char *p = itemText;
+    for (uint8_t line = first; line < first + linesPerItem; line++) {
+      const char *end = strchr(p, '\n');
+      const size_t len = end ? (size_t)(end - p) : strlen(p);
+      const size_t n = MIN(len, (size_t)LIST_LINE_CHARS);
+      memcpy(listView.text[line], p, n);
+      listView.text[line][n] = '\0';
+      p += end ? len + 1 : len;
     }
-    
-    // Maksymalna liczba znaków na linię (128 pikseli / 7 pikseli na znak = ~18)
-    const uint8_t MAX_CHARS_PER_LINE = 18;
-    // Draw visible items
-    for (uint8_t i = 0; i < MAX_LINES; i++) {
-        uint8_t itemIndex = i + scrollOffset;
-        if (itemIndex >= numItems) break;
-        
-        char itemText[32];
-        getItemText(itemIndex, itemText);
-        
-        uint8_t lineNumber = FIRST_ITEM_LINE + i;
-        
-        // Wyrównanie maksymalnie do lewej
-        if (itemIndex == selectedIndex) {
-            // Zaznaczony element - ">" + tekst, maksymalnie wykorzystaj przestrzeń
-            char displayText[MAX_CHARS_PER_LINE + 1];
-            strcpy(displayText, itemText);
-            char selectedText[MAX_CHARS_PER_LINE + 2];
-            sprintf(selectedText, ">%2s", displayText);
-            UI_PrintStringSmall(selectedText, 1, 0, lineNumber);
-            
-        } else {
-            char displayText[MAX_CHARS_PER_LINE + 1];
-            strcpy(displayText, itemText);
-            UI_PrintStringSmall(displayText, 1, 0, lineNumber); // Minimalne wcięcie
-          }
-          
+    redraw |= mask;
+  }
+  listView.staleLines = 0;
+
+  for (uint8_t line = 0; line < MAX_VISIBLE_LINES; line++) {
+    const uint8_t itemIndex = scrollOffset + line / linesPerItem;
+    char lineText[LIST_LINE_CHARS + 2];
+    char *p = lineText;
+
+    if (!(redraw & (1u << line)))
+      continue;
+
+    memset(gFrameBuffer[1 + line], 0, sizeof(gFrameBuffer[0]));
+    if (itemIndex >= numItems)
+      continue;
+
+    // single line items only make room for the marker on the selected line
+    if (line % linesPerItem == 0) {
+      if (itemIndex == selectedIndex)
+        *p++ = '>';
+      else if (linesPerItem > 1)
+        *p++ = ' ';
     }
-    
-    ST7565_BlitFullScreen();
+    strcpy(p, listView.text[line]);
+    UI_PrintStringSmall(lineText, 1, 0, 1 + line);
+  }
+}
+
+static void RenderList(const char* title, uint8_t numItems, uint8_t selectedIndex, uint8_t scrollOffset,
+                      ListItemText_t getItemText) {
+    RenderListView(title, numItems, selectedIndex, scrollOffset, getItemText, 1);
 }
 
 
@@ -2579,7 +3135,6 @@ static void RenderList(const char* title, uint8_t numItems, uint8_t selectedInde
 
 // Fonction pour afficher le menu ScanList
 static void RenderScanListSelect() {
-    BuildValidScanListIndices(); 
     RenderList("SCANLISTS:", validScanListCount,scanListSelectedIndex, scanListScrollOffset, GetFilteredScanListText);
 }
 
@@ -2590,12 +3145,10 @@ static void RenderParametersSelect() {
 static void RenderBandSelect() {RenderList("BANDS:", ARRAY_SIZE(BParams),bandListSelectedIndex, bandListScrollOffset, GetBandItemText);}
 
 static void RenderHistoryList() {
-    uint8_t validItems = CountValidHistoryItems();
-    
     char headerString[24];
-    sprintf(headerString, "HISTORY: %d", validItems);
+    sprintf(headerString, "HISTORY: %d", historyCount);
     
-    RenderList(headerString, validItems, 
+    RenderList(headerString, historyCount, 
               historyListIndex, historyScrollOffset, GetHistoryItemText);
 }
 
@@ -2625,42 +3178,22 @@ static void RenderScanListChannels() {
                                      scanListChannelsScrollOffset);
 }
 
-static void RenderScanListChannelsDoubleLines(const char* title, uint8_t numItems, 
-                                             uint8_t selectedIndex, uint8_t scrollOffset) {
-    memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
-    UI_PrintStringSmallBold(title, 1, LCD_WIDTH - 1, 0);
-    
-    const uint8_t MAX_ITEMS_VISIBLE = 3; // 3 kanały x 2 linie = 6 linii
+static void GetScanListChannelText(uint8_t index, char *buffer) {
+    uint8_t channelIndex = scanListChannels[index];
+    char channel_name[10];
+    SETTINGS_FetchChannelName(channel_name, channelIndex);
     
-    for (uint8_t i = 0; i < MAX_ITEMS_VISIBLE; i++) {
-        uint8_t itemIndex = i + scrollOffset;
-        if (itemIndex >= numItems) break;
-        
-        uint8_t channelIndex = scanListChannels[itemIndex];
-        char channel_name[10];
-        SETTINGS_FetchChannelName(channel_name, channelIndex);
-        
-        uint32_t freq = gMR_ChannelFrequencyAttributes[channelIndex].Frequency;
-        char freqStr[16];
-        sprintf(freqStr, "... %u.%05u", freq/100000, freq%100000);
-        RemoveTrailZeros(freqStr);
-        
-        uint8_t line1 = 1 + i * 2;
-        uint8_t line2 = 2 + i * 2;
-        
-        char nameText[20], freqText[20];
-        if (itemIndex == selectedIndex) {
-            sprintf(nameText, ">%3d: %s", channelIndex + 1, channel_name);
-            sprintf(freqText, " %s", freqStr);
-        } else {
-            sprintf(nameText, " %3d: %s", channelIndex + 1, channel_name);
-            sprintf(freqText, " %s", freqStr);
-        }
-        
-        UI_PrintStringSmall(nameText, 1, 0, line1);
-        UI_PrintStringSmall(freqText, 1, 0, line2);
-    }
+    uint32_t freq = gMR_ChannelFrequencyAttributes[channelIndex].Frequency;
+    char freqStr[16];
+    sprintf(freqStr, "... %u.%05u", freq/100000, freq%100000);
+    RemoveTrailZeros(freqStr);
     
-    ST7565_BlitFullScreen();
+    sprintf(buffer, "%3d: %s\n %s", channelIndex + 1, channel_name, freqStr);
+}
+
+static void RenderScanListChannelsDoubleLines(const char* title, uint8_t numItems, 
+                                             uint8_t selectedIndex, uint8_t scrollOffset) {
+    // 3 kanały x 2 linie = 6 linii
+    RenderListView(title, numItems, selectedIndex, scrollOffset, GetScanListChannelText, 2);
 }
 #endif // ENABLE_SCANLIST_SHOW_DETAIL
\ No newline at end of file
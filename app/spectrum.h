@@ -42,7 +42,7 @@
 
 
 
-static const uint8_t DrawingEndY = 50; //Robby69 48  55
+enum { DrawingEndY = 50 }; //Robby69 48  55, an enum so it can size arrays
 
 static const uint8_t U8RssiMap[] = {
     121, 115, 109, 103, 97, 91, 85, 79, 73, 63,
@@ -197,8 +197,18 @@ typedef struct PeakInfo {
   uint16_t i;
 } PeakInfo;
 
+typedef struct SpectrumSample {
+  uint16_t rssi;
+  uint8_t  noise;
+  uint8_t  glitch;
+} SpectrumSample;
+
 void APP_RunSpectrum(uint8_t Spectrum_state);
 
+void SPECTRUM_RemoteSweepBegin(ModulationMode_t modulation);
+void SPECTRUM_RemoteSweepMeasure(uint32_t f, uint8_t dwellMs, SpectrumSample *sample);
+void SPECTRUM_RemoteSweepEnd(void);
+
 #ifdef ENABLE_SPECTRUM_SHOW_CHANNEL_NAME
   void LookupChannelInfo();
   void LookupChannelModulation();
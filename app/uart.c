@@ -25,6 +25,10 @@
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
 #endif
+#ifdef ENABLE_SPECTRUM
+	#include "app/eventlog.h"
+	#include "app/spectrum.h"
+#endif
 #include "app/uart.h"
 #include "board.h"
 #include "bsp/dp32g030/dma.h"
@@ -36,7 +40,10 @@
 #include "driver/gpio.h"
 #include "driver/uart.h"
 #include "functions.h"
+#include "helper/journal.h"
+#include "helper/profiler.h"
 #include "misc.h"
+#include "scheduler.h"
 #include "settings.h"
 #if defined(ENABLE_OVERLAY)
 	#include "sram-overlay.h"
@@ -140,6 +147,128 @@ typedef struct {
 	uint32_t Timestamp;
 } CMD_052F_t;
 
+typedef struct {
+	Header_t Header;
+	uint16_t Offset;
+	uint8_t  Padding[2];
+	uint32_t Timestamp;
+} CMD_0531_t;
+
+typedef struct {
+	Header_t Header;
+	uint16_t Offset;
+	uint16_t Size;
+	uint32_t Timestamp;
+} CMD_0533_t;
+
+typedef struct {
+	Header_t Header;
+	uint32_t BaudRate;
+	uint32_t Timestamp;
+} CMD_0535_t;
+
+#ifdef ENABLE_SPECTRUM
+typedef struct {
+	Header_t Header;
+	uint32_t Timestamp;
+	uint32_t Start;        // 10Hz, first frequency of a range
+	uint32_t Step;         // 10Hz, 0: Frequency[] holds the list
+	uint16_t Count;
+	uint8_t  Dwell;        // ms per point, 0: the spectrum delay
+	uint8_t  Modulation;   // ModulationMode_t
+	uint32_t Frequency[0];
+} CMD_053B_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Index;       // of the first point in this frame
+		uint8_t  Count;
+		uint8_t  Padding;
+		uint16_t Remaining;   // points still to come after this frame
+		uint8_t  Padding2[2];
+		SpectrumSample Point[32];
+	} Data;
+} REPLY_053B_t;
+
+typedef struct {
+	Header_t Header;
+	uint8_t  Clear;   // empty the log once the last frame is out
+	uint8_t  Padding[3];
+	uint32_t Timestamp;
+} CMD_053D_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Now;         // 10ms ticks, to turn the event start ticks into times
+		uint8_t  Index;       // of the first event in this frame, 0 is the oldest
+		uint8_t  Count;
+		uint8_t  Remaining;   // events still to come after this frame
+		uint8_t  Padding;
+		EVENTLOG_Event_t Event[8];
+	} Data;
+} REPLY_053D_t;
+#endif
+
+typedef struct {
+	Header_t Header;
+	uint8_t  Mode;   // UART_Telemetry_t
+	uint8_t  Padding[3];
+	uint32_t Timestamp;
+} CMD_0537_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint8_t Mode;
+		uint8_t Padding[3];
+	} Data;
+} REPLY_0537_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t BaudRate;   // rate in use after this reply
+	} Data;
+} REPLY_0535_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Offset;
+		uint8_t  Size;
+		uint8_t  Padding;
+		uint16_t CRC;         // running CRC of the data streamed so far, this frame included
+		uint16_t Remaining;   // bytes still to come after this frame
+		uint8_t  Data[128];
+	} Data;
+} REPLY_0533_t;
+
+typedef struct {
+	Header_t Header;
+	EEPROM_Benchmark_t Data;
+} REPLY_0531_t;
+
+#ifdef ENABLE_PROFILER
+typedef struct {
+	Header_t Header;
+	uint8_t  Reset;   // start over once the reply is built
+	uint8_t  Padding[3];
+	uint32_t Timestamp;
+} CMD_053F_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t CyclesPerTick;   // core cycles in a 10ms tick
+		uint32_t SleepCycles;     // wrapping totals since boot
+		uint32_t ActiveCycles;
+		PROFILER_Stats_t Section[PROFILER_SECTION_COUNT];
+	} Data;
+} REPLY_053F_t;
+#endif
+
 static const uint8_t Obfuscation[16] =
 {
 	0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80
@@ -156,8 +285,52 @@ static union
 } UART_Command;
 
 static uint32_t Timestamp;
-static uint16_t gUART_WriteIndex;
+static uint16_t gUART_WriteIndex;   // parse position in UART_DMA_Buffer
+static uint16_t gFrameSize;         // payload size of the frame at gUART_WriteIndex, 0 = header not seen yet
 static bool     bIsEncrypted = true;
+static uint8_t  gBaudRateConfirmCountdown_10ms;   // a valid frame has to arrive at the new rate before this expires
+static uint8_t  gTelemetryCountdown_10ms;         // frames went out recently, the PC is still listening
+static UART_Telemetry_t gTelemetry;
+
+// commands that take longer than a timeslice run in steps from the main loop
+enum JobType_t {
+	JOB_NONE = 0,
+	JOB_WRITE,    // 0x051D
+	JOB_STREAM,   // 0x0533
+#ifdef ENABLE_SPECTRUM
+	JOB_SWEEP,    // 0x053B
+	JOB_EVENTS,   // 0x053D
+#endif
+};
+typedef enum JobType_t JobType_t;
+
+static struct {
+	JobType_t Type;
+	uint16_t  Offset;   // next EEPROM address
+	uint16_t  End;
+	uint16_t  CRC;
+	bool      bLocked;
+	bool      bReloadEeprom;
+	bool      bClear;   // 0x053D: empty the event log at the end
+} gJob;
+
+#ifdef ENABLE_SPECTRUM
+	static REPLY_053B_t gSweepReply;   // filled one point per step
+#endif
+
+static void RestoreBaudRate(void)
+{
+	gBaudRateConfirmCountdown_10ms = 0;
+	UART_SetBaudRate(UART_BAUD_DEFAULT);
+}
+
+// a frame that doesn't check out at a raised rate means the PC lost sync, go back to the default
+static bool BadFrame(void)
+{
+	if (UART_GetBaudRate() != UART_BAUD_DEFAULT)
+		RestoreBaudRate();
+	return false;
+}
 
 static void SendReply(void *pReply, uint16_t Size)
 {
@@ -224,6 +397,9 @@ static void CMD_0514(const uint8_t *pBuffer)
 	// turn the LCD backlight off
 	BACKLIGHT_TurnOff();
 
+	// the PC reads/writes the home locations, bring them up to date
+	JOURNAL_Sync();
+
 	SendVersion();
 }
 
@@ -257,49 +433,281 @@ static void CMD_051B(const uint8_t *pBuffer)
 	SendReply(&Reply, pCmd->Size + 8);
 }
 
+// streams an EEPROM range as back-to-back 0x0534 frames, no request per block
+static void CMD_0533(const uint8_t *pBuffer)
+{
+	const CMD_0533_t *pCmd = (const CMD_0533_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	if (pCmd->Offset >= 0x2000 || pCmd->Size > 0x2000 - pCmd->Offset)
+		return;
+
+	#ifdef ENABLE_FMRADIO
+		gFmRadioCountdown_500ms = fm_radio_countdown_500ms;
+	#endif
+
+	gJob.Type    = JOB_STREAM;
+	gJob.Offset  = pCmd->Offset;
+	gJob.End     = pCmd->Offset + pCmd->Size;
+	gJob.CRC     = 0;
+	gJob.bLocked = bHasCustomAesKey ? gIsLocked : false;
+}
+
+// one frame per step, and only once the TX ring can take it without waiting
+static void StreamStep(void)
+{
+	REPLY_0533_t   Reply;
+	const uint16_t Left = gJob.End - gJob.Offset;
+
+	memset(&Reply, 0, sizeof(Reply));
+	Reply.Data.Offset    = gJob.Offset;
+	Reply.Data.Size      = (Left > sizeof(Reply.Data.Data)) ? sizeof(Reply.Data.Data) : Left;
+	Reply.Data.Remaining = Left - Reply.Data.Size;
+	Reply.Header.ID      = 0x0534;
+	Reply.Header.Size    = Reply.Data.Size + 8;
+
+	if (UART_TxSpace() < Reply.Data.Size + 12U + 8U)
+		return;
+
+	if (!gJob.bLocked)
+		EEPROM_ReadBuffer(gJob.Offset, Reply.Data.Data, Reply.Data.Size);
+
+	gJob.CRC       = CRC_Update(gJob.CRC, Reply.Data.Data, Reply.Data.Size);
+	Reply.Data.CRC = gJob.CRC;
+
+	gSerialConfigCountDown_500ms = 12; // 6 sec
+
+	SendReply(&Reply, Reply.Data.Size + 12);
+
+	gJob.Offset += Reply.Data.Size;
+	if (gJob.Offset >= gJob.End)
+		gJob.Type = JOB_NONE;
+}
+
+// switches the line rate, the reply still goes out at the old rate
+static void CMD_0535(const uint8_t *pBuffer)
+{
+	const CMD_0535_t *pCmd = (const CMD_0535_t *)pBuffer;
+	REPLY_0535_t      Reply;
+	uint32_t          BaudRate = pCmd->BaudRate;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	gSerialConfigCountDown_500ms = 12; // 6 sec
+
+	if (!UART_IsBaudRateSupported(BaudRate))
+		BaudRate = UART_GetBaudRate();
+
+	Reply.Header.ID     = 0x0536;
+	Reply.Header.Size   = sizeof(Reply.Data);
+	Reply.Data.BaudRate = BaudRate;
+
+	SendReply(&Reply, sizeof(Reply));
+
+	if (BaudRate != UART_GetBaudRate())
+	{
+		UART_SetBaudRate(BaudRate);
+		gBaudRateConfirmCountdown_10ms = (BaudRate == UART_BAUD_DEFAULT) ? 0 : 100;   // 1 sec
+	}
+}
+
+#ifdef ENABLE_SPECTRUM
+// measures a frequency range or list on the radio, results come back as 0x053C frames
+static void CMD_053B(const uint8_t *pBuffer)
+{
+	const CMD_053B_t *pCmd = (const CMD_053B_t *)pBuffer;
+	const uint16_t Listed = (UART_Command.Header.Size > sizeof(CMD_053B_t) - sizeof(Header_t))
+		? (UART_Command.Header.Size - (sizeof(CMD_053B_t) - sizeof(Header_t))) / sizeof(uint32_t)
+		: 0;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	// a list has to fit in the command, at most 57 frequencies in the 248 bytes a frame carries
+	if (pCmd->Count == 0 || (pCmd->Step == 0 && (pCmd->Count > Listed || pCmd->Count > (sizeof(UART_DMA_Buffer) - 8 - sizeof(CMD_053B_t)) / sizeof(uint32_t))))
+		return;
+
+	gSerialConfigCountDown_500ms = 12; // 6 sec
+
+	gJob.Type   = JOB_SWEEP;
+	gJob.Offset = 0;
+	gJob.End    = pCmd->Count;
+
+	memset(&gSweepReply, 0, sizeof(gSweepReply));
+
+	SPECTRUM_RemoteSweepBegin(pCmd->Modulation);
+}
+
+// one point per step, a frame goes out every 32 points and after the last one
+static void SweepStep(void)
+{
+	const CMD_053B_t *pCmd = (const CMD_053B_t *)UART_Command.Buffer;
+	const uint16_t    Index = gJob.Offset;
+	uint8_t           n     = gSweepReply.Data.Count;
+	uint32_t          Frequency;
+
+	if (n == ARRAY_SIZE(gSweepReply.Data.Point) || Index == gJob.End)
+	{
+		if (UART_TxSpace() < sizeof(gSweepReply) + 8U)
+			return;
+
+		gSweepReply.Header.ID      = 0x053C;
+		gSweepReply.Header.Size    = sizeof(gSweepReply.Data) - sizeof(gSweepReply.Data.Point) + n * sizeof(SpectrumSample);
+		gSweepReply.Data.Index     = Index - n;
+		gSweepReply.Data.Remaining = gJob.End - Index;
+
+		gSerialConfigCountDown_500ms = 12; // 6 sec
+
+		SendReply(&gSweepReply, gSweepReply.Header.Size + sizeof(Header_t));
+		memset(&gSweepReply, 0, sizeof(gSweepReply));
+
+		if (Index == gJob.End)
+		{
+			gJob.Type = JOB_NONE;
+			SPECTRUM_RemoteSweepEnd();
+		}
+		return;
+	}
+
+	Frequency = (pCmd->Step == 0) ? pCmd->Frequency[Index] : pCmd->Start + (uint32_t)Index * pCmd->Step;
+
+	SPECTRUM_RemoteSweepMeasure(Frequency, pCmd->Dwell, &gSweepReply.Data.Point[n]);
+
+	gSweepReply.Data.Count = n + 1;
+	gJob.Offset++;
+}
+
+// dumps the spectrum event log as 0x053E frames
+static void CMD_053D(const uint8_t *pBuffer)
+{
+	const CMD_053D_t *pCmd = (const CMD_053D_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	gSerialConfigCountDown_500ms = 12; // 6 sec
+
+	gJob.Type   = JOB_EVENTS;
+	gJob.Offset = 0;
+	gJob.End    = EVENTLOG_Count();
+	gJob.bClear = pCmd->Clear;
+}
+
+// one frame per step, an empty log still gets one frame
+static void EventsStep(void)
+{
+	REPLY_053D_t Reply;
+	uint8_t      n = 0;
+
+	if (UART_TxSpace() < sizeof(Reply) + 8U)
+		return;
+
+	memset(&Reply, 0, sizeof(Reply));
+
+	while (n < ARRAY_SIZE(Reply.Data.Event) && gJob.Offset < gJob.End && EVENTLOG_Get(gJob.Offset, &Reply.Data.Event[n])) {
+		gJob.Offset++;
+		n++;
+	}
+
+	if (n == 0)
+		gJob.Offset = gJob.End;   // the log was cleared in between
+
+	Reply.Header.ID      = 0x053E;
+	Reply.Header.Size    = sizeof(Reply.Data) - sizeof(Reply.Data.Event) + n * sizeof(EVENTLOG_Event_t);
+	Reply.Data.Now       = SCHEDULER_GetTick();
+	Reply.Data.Index     = gJob.Offset - n;
+	Reply.Data.Count     = n;
+	Reply.Data.Remaining = gJob.End - gJob.Offset;
+
+	SendReply(&Reply, Reply.Header.Size + sizeof(Header_t));
+
+	if (gJob.Offset >= gJob.End) {
+		if (gJob.bClear)
+			EVENTLOG_Clear();
+		gJob.Type = JOB_NONE;
+	}
+}
+#endif
+
+// spectrum sweeps are pushed as 0x0539 frames while the mode is on
+static void CMD_0537(const uint8_t *pBuffer)
+{
+	const CMD_0537_t *pCmd = (const CMD_0537_t *)pBuffer;
+	REPLY_0537_t      Reply;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	gTelemetry = (pCmd->Mode <= UART_TELEMETRY_4BIT) ? (UART_Telemetry_t)pCmd->Mode : UART_TELEMETRY_OFF;
+
+	Reply.Header.ID   = 0x0538;
+	Reply.Header.Size = sizeof(Reply.Data);
+	memset(&Reply.Data, 0, sizeof(Reply.Data));
+	Reply.Data.Mode   = gTelemetry;
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
 static void CMD_051D(const uint8_t *pBuffer)
 {
 	const CMD_051D_t *pCmd = (const CMD_051D_t *)pBuffer;
-	REPLY_051D_t Reply;
-	bool bReloadEeprom;
-	bool bIsLocked;
 
 	if (pCmd->Timestamp != Timestamp)
 		return;
 
 	gSerialConfigCountDown_500ms = 12; // 6 sec
 
-	bReloadEeprom = false;
-
 	#ifdef ENABLE_FMRADIO
 		gFmRadioCountdown_500ms = fm_radio_countdown_500ms;
 	#endif
 
-	Reply.Header.ID   = 0x051E;
-	Reply.Header.Size = sizeof(Reply.Data);
-	Reply.Data.Offset = pCmd->Offset;
+	// the command stays in UART_Command, nothing new is parsed until the job is done
+	gJob.Type          = JOB_WRITE;
+	gJob.Offset        = pCmd->Offset;
+	gJob.End           = pCmd->Offset + (pCmd->Size & ~7u);
+	gJob.bLocked       = bHasCustomAesKey ? gIsLocked : bHasCustomAesKey;
+	gJob.bReloadEeprom = false;
+}
 
-	bIsLocked = bHasCustomAesKey ? gIsLocked : bHasCustomAesKey;
+// one EEPROM page per step, the reply goes out after the last one
+static void WriteStep(void)
+{
+	const CMD_051D_t *pCmd = (const CMD_051D_t *)UART_Command.Buffer;
+	REPLY_051D_t      Reply;
 
-	if (!bIsLocked)
+	if (!gJob.bLocked && gJob.Offset < gJob.End)
 	{
-		unsigned int i;
-		for (i = 0; i < (pCmd->Size / 8); i++)
-		{
-			const uint16_t Offset = pCmd->Offset + (i * 8U);
+		const uint16_t Offset = gJob.Offset;
 
-			if (Offset >= 0x0F30 && Offset < 0x0F40)
-				if (!gIsLocked)
-					bReloadEeprom = true;
+		if (Offset >= 0x0F30 && Offset < 0x0F40)
+			if (!gIsLocked)
+				gJob.bReloadEeprom = true;
 
-			if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword)
-				EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U], true);
-		}
+		if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword)
+			EEPROM_WriteBuffer(Offset, &pCmd->Data[Offset - pCmd->Offset], true);
+
+		gJob.Offset += 8;
+		if (gJob.Offset < gJob.End)
+			return;
+
+		// home locations may have been rewritten, drop the cached journal values
+		JOURNAL_Init();
 
-		if (bReloadEeprom)
+		if (gJob.bReloadEeprom)
 			BOARD_EEPROM_Init();
 	}
 
+	gJob.Type = JOB_NONE;
+
+	gSerialConfigCountDown_500ms = 12; // 6 sec
+
+	Reply.Header.ID   = 0x051E;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Offset = pCmd->Offset;
+
 	SendReply(&Reply, sizeof(Reply));
 }
 
@@ -329,6 +737,49 @@ static void CMD_0529(void)
 	SendReply(&Reply, sizeof(Reply));
 }
 
+// EEPROM bus throughput, the data at Offset is rewritten unchanged, Offsets in
+// the calibration area are refused with EEPROM_BENCHMARK_BAD_ADDRESS
+static void CMD_0531(const uint8_t *pBuffer)
+{
+	const CMD_0531_t *pCmd = (const CMD_0531_t *)pBuffer;
+	REPLY_0531_t      Reply;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	Reply.Header.ID   = 0x0532;
+	Reply.Header.Size = sizeof(Reply.Data);
+
+	EEPROM_Benchmark(pCmd->Offset & ~7u, &Reply.Data);
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+#ifdef ENABLE_PROFILER
+// per section execution times and the sleep/active split of the core
+static void CMD_053F(const uint8_t *pBuffer)
+{
+	const CMD_053F_t *pCmd = (const CMD_053F_t *)pBuffer;
+	REPLY_053F_t      Reply;
+
+	if (pCmd->Timestamp != Timestamp)
+		return;
+
+	Reply.Header.ID          = 0x0540;
+	Reply.Header.Size        = sizeof(Reply.Data);
+	Reply.Data.CyclesPerTick = SysTick->LOAD + 1;
+
+	SCHEDULER_GetCycles(&Reply.Data.SleepCycles, &Reply.Data.ActiveCycles);
+	for (unsigned int i = 0; i < PROFILER_SECTION_COUNT; i++)
+		PROFILER_Get(i, &Reply.Data.Section[i]);
+
+	if (pCmd->Reset)
+		PROFILER_Reset();
+
+	SendReply(&Reply, sizeof(Reply));
+}
+#endif
+
 static void CMD_052F(const uint8_t *pBuffer)
 {
 	const CMD_052F_t *pCmd = (const CMD_052F_t *)pBuffer;
@@ -363,16 +814,25 @@ static void CMD_052F(const uint8_t *pBuffer)
 	SendVersion();
 }
 
+// bytes the DMA has put in the ring past the parse position
+static uint16_t Pending(uint16_t DmaLength)
+{
+	return (DmaLength + sizeof(UART_DMA_Buffer) - gUART_WriteIndex) % sizeof(UART_DMA_Buffer);
+}
+
+/*
+Parses the ring in place: the header and footer are checked where the DMA put them and the
+payload is read once, de-obfuscated on its way into the aligned buffer the handlers cast to.
+A frame that isn't complete yet keeps its parsed size for the next call.
+*/
 bool UART_IsCommandAvailable(void)
 {
 	uint16_t Index;
-	uint16_t TailIndex;
 	uint16_t Size;
 	uint16_t CRC;
-	uint16_t CommandLength;
 	uint16_t DmaLength = DMA_CH0->ST & 0xFFFU;
 
-	while (1)
+	while (gFrameSize == 0)
 	{
 		if (gUART_WriteIndex == DmaLength)
 			return false;
@@ -402,80 +862,168 @@ bool UART_IsCommandAvailable(void)
 		while (gUART_WriteIndex != DmaLength && UART_DMA_Buffer[gUART_WriteIndex] != 0xABU)
 			gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
 
-		if (gUART_WriteIndex == DmaLength)
+		if (Pending(DmaLength) < 4)
 			return false;
 
-		if (gUART_WriteIndex < DmaLength)
-			CommandLength = DmaLength - gUART_WriteIndex;
-		else
-			CommandLength = (DmaLength + sizeof(UART_DMA_Buffer)) - gUART_WriteIndex;
+		if (UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 1)] != 0xCD)
+		{
+			gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+			continue;
+		}
 
-		if (CommandLength < 8)
-			return 0;
+		Size = (UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 3)] << 8) | UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 2)];
 
-		if (UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 1)] == 0xCD)
-			break;
+		if ((Size + 8u) > sizeof(UART_DMA_Buffer))
+		{
+			gUART_WriteIndex = DmaLength;
+			return BadFrame();
+		}
 
-		gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+		gFrameSize = Size;
 	}
 
-	Index = DMA_INDEX(gUART_WriteIndex, 2);
-	Size  = (UART_DMA_Buffer[DMA_INDEX(Index, 1)] << 8) | UART_DMA_Buffer[Index];
-
-	if ((Size + 8u) > sizeof(UART_DMA_Buffer))
-	{
-		gUART_WriteIndex = DmaLength;
-		return false;
-	}
+	Size = gFrameSize;
 
-	if (CommandLength < (Size + 8))
+	if (Pending(DmaLength) < (Size + 8u))
 		return false;
 
-	Index     = DMA_INDEX(Index, 2);
-	TailIndex = DMA_INDEX(Index, Size + 2);
+	// the whole frame is in, whatever the outcome the parser moves past it
+	gFrameSize = 0;
 
-	if (UART_DMA_Buffer[TailIndex] != 0xDC || UART_DMA_Buffer[DMA_INDEX(TailIndex, 1)] != 0xBA)
+	Index = DMA_INDEX(gUART_WriteIndex, Size + 6);
+	if (UART_DMA_Buffer[Index] != 0xDC || UART_DMA_Buffer[DMA_INDEX(Index, 1)] != 0xBA)
 	{
 		gUART_WriteIndex = DmaLength;
-		return false;
+		return BadFrame();
 	}
 
-	if (TailIndex < Index)
-	{
-		const uint16_t ChunkSize = sizeof(UART_DMA_Buffer) - Index;
-		memmove(UART_Command.Buffer, UART_DMA_Buffer + Index, ChunkSize);
-		memmove(UART_Command.Buffer + ChunkSize, UART_DMA_Buffer, TailIndex);
+	Index = DMA_INDEX(gUART_WriteIndex, 4);
+
+	// a plain hello switches obfuscation off, an obfuscated one back on
+	if (UART_DMA_Buffer[Index] == 0x14 && UART_DMA_Buffer[DMA_INDEX(Index, 1)] == 0x05)
+		bIsEncrypted = false;
+
+	if (UART_DMA_Buffer[Index] == 0x02 && UART_DMA_Buffer[DMA_INDEX(Index, 1)] == 0x69)
+		bIsEncrypted = true;
+
+	{	// payload + CRC, de-obfuscated straight out of the ring
+		unsigned int i;
+
+		if (bIsEncrypted)
+			for (i = 0; i < Size + 2u; i++)
+				UART_Command.Buffer[i] = UART_DMA_Buffer[DMA_INDEX(Index, i)] ^ Obfuscation[i % 16];
+		else
+			for (i = 0; i < Size + 2u; i++)
+				UART_Command.Buffer[i] = UART_DMA_Buffer[DMA_INDEX(Index, i)];
 	}
-	else
-		memmove(UART_Command.Buffer, UART_DMA_Buffer + Index, TailIndex - Index);
 
-	TailIndex = DMA_INDEX(TailIndex, 2);
-	if (TailIndex < gUART_WriteIndex)
+	gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, Size + 8);
+
+	CRC = UART_Command.Buffer[Size] | (UART_Command.Buffer[Size + 1] << 8);
+
+	if (CRC_Calculate(UART_Command.Buffer, Size) != CRC)
+		return BadFrame();
+
+	gBaudRateConfirmCountdown_10ms = 0;
+
+	return true;
+}
+
+bool UART_IsBusy(void)
+{
+	return gJob.Type != JOB_NONE;
+}
+
+// a 0x053B sweep owns the BK4819 until its last frame is out
+bool UART_IsSweeping(void)
+{
+#ifdef ENABLE_SPECTRUM
+	return gJob.Type == JOB_SWEEP;
+#else
+	return false;
+#endif
+}
+
+// advances the running command by one step, interrupts stay enabled
+void UART_RunJob(void)
+{
+	switch (gJob.Type)
 	{
-		memset(UART_DMA_Buffer + gUART_WriteIndex, 0, sizeof(UART_DMA_Buffer) - gUART_WriteIndex);
-		memset(UART_DMA_Buffer, 0, TailIndex);
+		case JOB_WRITE:
+			WriteStep();
+			break;
+
+		case JOB_STREAM:
+			StreamStep();
+			break;
+
+#ifdef ENABLE_SPECTRUM
+		case JOB_SWEEP:
+			SweepStep();
+			break;
+
+		case JOB_EVENTS:
+			EventsStep();
+			break;
+#endif
+
+		default:
+			break;
 	}
-	else
-		memset(UART_DMA_Buffer + gUART_WriteIndex, 0, TailIndex - gUART_WriteIndex);
+}
 
-	gUART_WriteIndex = TailIndex;
+void UART_TimeSlice10ms(void)
+{
+	if (gTelemetryCountdown_10ms > 0)
+		gTelemetryCountdown_10ms--;
 
-	if (UART_Command.Header.ID == 0x0514)
-		bIsEncrypted = false;
+	if (UART_GetBaudRate() == UART_BAUD_DEFAULT)
+		return;
 
-	if (UART_Command.Header.ID == 0x6902)
-		bIsEncrypted = true;
+	// nothing valid came in at the new rate, or the programming/telemetry session is over
+	if (gBaudRateConfirmCountdown_10ms > 0) {
+		if (--gBaudRateConfirmCountdown_10ms == 0)
+			RestoreBaudRate();
+	}
+	else if (gSerialConfigCountDown_500ms == 0 && gTelemetryCountdown_10ms == 0)
+		RestoreBaudRate();
+}
 
-	if (bIsEncrypted)
+// for loops that keep the main loop from running, e.g. the spectrum
+void UART_Service(void)
+{
+	UART_Poll();
+	UART_RunJob();
+
+	if (gNextTimeslice)
 	{
-		unsigned int i;
-		for (i = 0; i < (Size + 2u); i++)
-			UART_Command.Buffer[i] ^= Obfuscation[i % 16];
+		gNextTimeslice = false;
+
+		UART_TimeSlice10ms();
+
+		if (!UART_IsBusy() && UART_IsCommandAvailable())
+			PROFILE(PROFILER_UART_COMMAND, UART_HandleCommand());
 	}
+}
 
-	CRC = UART_Command.Buffer[Size] | (UART_Command.Buffer[Size + 1] << 8);
+/*
+Sends a frame only if the TX ring can take all of it, used by streams that would rather
+drop a frame than hold up the radio
+*/
+bool UART_TrySendFrame(void *pFrame, uint16_t Size)
+{
+	if (UART_TxSpace() < Size + 8U)
+		return false;
 
-	return (CRC_Calculate(UART_Command.Buffer, Size) != CRC) ? false : true;
+	gTelemetryCountdown_10ms = 200;   // 2 sec
+
+	SendReply(pFrame, Size);
+	return true;
+}
+
+UART_Telemetry_t UART_GetTelemetry(void)
+{
+	return gTelemetry;
 }
 
 void UART_HandleCommand(void)
@@ -512,6 +1060,38 @@ void UART_HandleCommand(void)
 			CMD_052F(UART_Command.Buffer);
 			break;
 
+		case 0x0531:
+			CMD_0531(UART_Command.Buffer);
+			break;
+
+		case 0x0533:
+			CMD_0533(UART_Command.Buffer);
+			break;
+
+		case 0x0535:
+			CMD_0535(UART_Command.Buffer);
+			break;
+
+		case 0x0537:
+			CMD_0537(UART_Command.Buffer);
+			break;
+
+#ifdef ENABLE_SPECTRUM
+		case 0x053B:
+			CMD_053B(UART_Command.Buffer);
+			break;
+
+		case 0x053D:
+			CMD_053D(UART_Command.Buffer);
+			break;
+#endif
+
+#ifdef ENABLE_PROFILER
+		case 0x053F:
+			CMD_053F(UART_Command.Buffer);
+			break;
+#endif
+
 		case 0x05DD:
 			#if defined(ENABLE_OVERLAY)
 				overlay_FLASH_RebootToBootloader();
@@ -21,9 +21,24 @@
 #define APP_UART_H
 
 #include <stdbool.h>
+#include <stdint.h>
+
+enum UART_Telemetry_t {
+	UART_TELEMETRY_OFF = 0,
+	UART_TELEMETRY_8BIT,    // one byte per bin, offset from the sweep minimum
+	UART_TELEMETRY_4BIT,    // two bins per byte, offset from the sweep minimum scaled by a shift
+};
+typedef enum UART_Telemetry_t UART_Telemetry_t;
 
 bool UART_IsCommandAvailable(void);
 void UART_HandleCommand(void);
+void UART_TimeSlice10ms(void);
+bool UART_IsBusy(void);
+bool UART_IsSweeping(void);
+void UART_RunJob(void);
+void UART_Service(void);
+bool UART_TrySendFrame(void *pFrame, uint16_t Size);
+UART_Telemetry_t UART_GetTelemetry(void);
 
 #endif
 
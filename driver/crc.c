@@ -51,3 +51,13 @@ uint16_t CRC_Calculate(const void *pBuffer, uint16_t Size)
 	return Crc;
 }
 
+// continues a CRC over consecutive buffers, start with Crc = 0
+uint16_t CRC_Update(uint16_t Crc, const void *pBuffer, uint16_t Size)
+{
+	CRC_IV = Crc;
+	Crc    = CRC_Calculate(pBuffer, Size);
+	CRC_IV = 0;
+
+	return Crc;
+}
+
@@ -20,22 +20,48 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "ARMCM0.h"
 #include "driver/eeprom.h"
 #include "driver/i2c.h"
 #include "driver/system.h"
+#include "driver/systick.h"
+#include "scheduler.h"
 
 // EEPROM calibration tables start here
 #define EEPROM_WRITE_MAX_ADDR 0x1E00
 
-void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+// set once EEPROM_Benchmark has read this unit's EEPROM correctly at fast timing
+static bool gFastRead;
+
+// device address + word address, returns false if the EEPROM didn't acknowledge
+static bool Select(uint16_t Address)
 {
+	bool Ack;
+
 	I2C_Start();
 
-	I2C_Write(0xA0);
+	Ack = I2C_Write(0xA0) == 0;
 
 	I2C_Write((Address >> 8) & 0xFF);
 	I2C_Write((Address >> 0) & 0xFF);
 
+	return Ack;
+}
+
+// a NACK aborts the fast transfer, standard mode carries on as it always did
+// and only reports it
+static bool Read(I2C_Mode_t Mode, uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	bool Ack;
+
+	I2C_SetMode(Mode);
+
+	Ack = Select(Address);
+	if (!Ack && Mode == I2C_MODE_FAST) {
+		I2C_Stop();
+		return false;
+	}
+
 	I2C_Start();
 
 	I2C_Write(0xA1);
@@ -43,6 +69,51 @@ void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 	I2C_ReadBuffer(pBuffer, Size);
 
 	I2C_Stop();
+
+	return Ack;
+}
+
+static bool Write(I2C_Mode_t Mode, uint16_t Address, const void *pBuffer)
+{
+	bool Ack;
+
+	I2C_SetMode(Mode);
+
+	Ack = Select(Address);
+	if (!Ack && Mode == I2C_MODE_FAST) {
+		I2C_Stop();
+		return false;
+	}
+
+	I2C_WriteBuffer(pBuffer, 8);
+	I2C_Stop();
+
+	if (Mode == I2C_MODE_FAST) {
+		// the EEPROM ignores its address until the data is burnt in, poll for it
+		for (unsigned int i = 0; i < 100; i++) {
+			SYSTICK_DelayUs(100);
+			I2C_Start();
+			if (I2C_Write(0xA0) == 0) {
+				I2C_Stop();
+				return true;
+			}
+			I2C_Stop();
+		}
+	}
+
+	// give the EEPROM time to burn the data in (apparently takes 5ms)
+	SYSTEM_DelayMs(8);
+
+	return Ack;
+}
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	// standard timing is the fallback if the fast transfer isn't acknowledged
+	if (!gFastRead || !Read(I2C_MODE_FAST, Address, pBuffer, Size))
+		Read(I2C_MODE_STANDARD, Address, pBuffer, Size);
+
+	I2C_SetMode(I2C_MODE_STANDARD);
 }
 
 /*
@@ -50,6 +121,8 @@ Writes to EEPROM
 Address: EEPROM address
 pBuffer: value
 safe: if set to false will allow overwriting calibration data
+A data bit lost at fast timing would be stored for good, writes always use
+standard timing.
 */
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer, const bool safe)
 {
@@ -59,15 +132,95 @@ void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer, const bool safe)
 	uint8_t buffer[8];
 	EEPROM_ReadBuffer(Address, buffer, 8); //Robby69 was 8
 	if (memcmp(pBuffer, buffer, 8) != 0)
-	{
-		I2C_Start();
-		I2C_Write(0xA0);
-		I2C_Write((Address >> 8) & 0xFF);
-		I2C_Write((Address >> 0) & 0xFF);
-		I2C_WriteBuffer(pBuffer, 8);
-		I2C_Stop();
+		Write(I2C_MODE_STANDARD, Address, pBuffer);
+}
+
+// core cycles since power on, the SysTick reloads included so a span may run
+// over several 10ms periods
+static uint32_t Now(void)
+{
+	uint32_t Sleep;
+	uint32_t Active;
+
+	SCHEDULER_GetCycles(&Sleep, &Active);
+
+	return Sleep + Active;
+}
+
+static uint32_t Rate(uint32_t Bytes, uint32_t Cycles)
+{
+	const uint32_t CyclesPerSecond = (SysTick->LOAD + 1) * 100;   // SysTick fires every 10ms
+
+	return Cycles ? (uint32_t)((uint64_t)Bytes * CyclesPerSecond / Cycles) : 0;
+}
+
+/*
+Measures the bus throughput in both modes
+Address: 8 bytes at this address are written back with what a standard mode
+read returned, the fast mode read is only compared against that copy. The
+rates of the steps that did not run are 0.
+EEPROM_ReadBuffer uses fast timing from an EEPROM_BENCHMARK_OK result on,
+until a later benchmark fails.
+*/
+void EEPROM_Benchmark(uint16_t Address, EEPROM_Benchmark_t *pResult)
+{
+	uint8_t  Reference[64];
+	uint8_t  Block[64];
+	uint32_t Start;
+	uint32_t Cycles[2][2] = {{0}};   // [mode][read, write]
+	bool     Ok;
+
+	memset(pResult, 0, sizeof(*pResult));
+	gFastRead = false;
+
+	if (Address >= EEPROM_WRITE_MAX_ADDR) {
+		pResult->Status = EEPROM_BENCHMARK_BAD_ADDRESS;
+		return;
 	}
 
-	// give the EEPROM time to burn the data in (apparently takes 5ms)
-	SYSTEM_DelayMs(8);
+	Start = Now();
+	Ok    = Read(I2C_MODE_STANDARD, Address, Reference, sizeof(Reference));
+	Cycles[I2C_MODE_STANDARD][0] = Now() - Start;
+
+	if (Ok) {
+		Start = Now();
+		Ok    = Write(I2C_MODE_STANDARD, Address, Reference);
+		Cycles[I2C_MODE_STANDARD][1] = Now() - Start;
+	}
+
+	if (!Ok) {
+		pResult->Status = EEPROM_BENCHMARK_NO_ACK;
+	}
+	else {
+		Start = Now();
+		Ok    = Read(I2C_MODE_FAST, Address, Block, sizeof(Block));
+		Cycles[I2C_MODE_FAST][0] = Now() - Start;
+
+		if (!Ok || memcmp(Block, Reference, sizeof(Block)) != 0) {
+			// the fast read can't be trusted, nothing of it goes back into the EEPROM
+			pResult->Status = EEPROM_BENCHMARK_FAST_MISMATCH;
+		}
+		else {
+			Start = Now();
+			Ok    = Write(I2C_MODE_FAST, Address, Reference);
+			Cycles[I2C_MODE_FAST][1] = Now() - Start;
+
+			// read back at standard timing, a bad fast write is put right at once
+			if (Ok && (!Read(I2C_MODE_STANDARD, Address, Block, 8) || memcmp(Block, Reference, 8) != 0))
+				pResult->Status = EEPROM_BENCHMARK_FAST_MISMATCH;
+			else
+				pResult->Status = Ok ? EEPROM_BENCHMARK_OK : EEPROM_BENCHMARK_NO_ACK;
+
+			if (pResult->Status != EEPROM_BENCHMARK_OK)
+				Write(I2C_MODE_STANDARD, Address, Reference);
+			gFastRead = pResult->Status == EEPROM_BENCHMARK_OK;
+		}
+	}
+
+	I2C_SetMode(I2C_MODE_STANDARD);
+
+	pResult->ReadStandard  = Rate(sizeof(Reference), Cycles[I2C_MODE_STANDARD][0]);
+	pResult->WriteStandard = Rate(8,                 Cycles[I2C_MODE_STANDARD][1]);
+	pResult->ReadFast      = Rate(sizeof(Block),     Cycles[I2C_MODE_FAST][0]);
+	pResult->WriteFast     = Rate(8,                 Cycles[I2C_MODE_FAST][1]);
 }
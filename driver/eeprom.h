@@ -23,8 +23,25 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+enum EEPROM_BenchmarkStatus_t {
+	EEPROM_BENCHMARK_OK = 0,
+	EEPROM_BENCHMARK_BAD_ADDRESS,     // in the calibration area, nothing was done
+	EEPROM_BENCHMARK_NO_ACK,          // standard mode transfer not acknowledged
+	EEPROM_BENCHMARK_FAST_MISMATCH    // fast read or write differs from the standard read, fast reads stay off
+};
+
+typedef struct {
+	uint32_t ReadStandard;    // bytes/s
+	uint32_t WriteStandard;
+	uint32_t ReadFast;
+	uint32_t WriteFast;
+	uint8_t  Status;          // EEPROM_BenchmarkStatus_t
+	uint8_t  Padding[3];
+} EEPROM_Benchmark_t;
+
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size);
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer, const bool safe);
+void EEPROM_Benchmark(uint16_t Address, EEPROM_Benchmark_t *pResult);
 
 #endif
 
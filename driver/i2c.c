@@ -22,29 +22,87 @@
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "driver/systick.h"
+#include "ARMCM0.h"
+
+// fast mode: ~0.85us per edge, SCL runs at ~400kHz, every bit is 3 edges
+#define I2C_FAST_EDGE_CYCLES 40
+
+// SDA samples taken for the ACK before giving up. The EEPROM answers within
+// the first few at fast timing, and the write cycle poll in driver/eeprom.c
+// sees a NACK on every try while the EEPROM is busy, so fast mode must not
+// spend the full standard count on each one.
+#define I2C_ACK_POLLS_STANDARD 255
+#define I2C_ACK_POLLS_FAST     8
+
+static I2C_Mode_t gI2C_Mode = I2C_MODE_STANDARD;
+static uint32_t   gI2C_FastLoops = I2C_FAST_EDGE_CYCLES / 4;
+
+static inline void Spin(uint32_t Loops)
+{
+	__asm volatile (
+		"1: subs %0, %0, #1 \n"
+		"   bne  1b         \n"
+		: "+l" (Loops)
+		:
+		: "cc"
+	);
+}
+
+static inline void I2C_Delay(void)
+{
+	if (gI2C_Mode == I2C_MODE_FAST)
+		Spin(gI2C_FastLoops);
+	else
+		SYSTICK_DelayUs(1);
+}
+
+// measures the spin loop against SysTick so the fast timing holds whatever the flash wait states are
+void I2C_Calibrate(void)
+{
+	const uint32_t Loops = 64;
+	uint32_t       Cycles;
+	uint32_t       Start;
+
+	__disable_irq();
+	Start = SYSTICK_GetValue();
+	Spin(Loops);
+	Cycles = SYSTICK_CyclesSince(Start);
+	__enable_irq();
+
+	Cycles = (Cycles + Loops - 1) / Loops;   // per loop
+	if (Cycles == 0)
+		Cycles = 1;
+
+	gI2C_FastLoops = (I2C_FAST_EDGE_CYCLES + Cycles - 1) / Cycles;
+}
+
+void I2C_SetMode(I2C_Mode_t Mode)
+{
+	gI2C_Mode = Mode;
+}
 
 void I2C_Start(void)
 {
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 }
 
 void I2C_Stop(void)
 {
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 }
 
 uint8_t I2C_Read(bool bFinal)
@@ -58,44 +116,45 @@ uint8_t I2C_Read(bool bFinal)
 	Data = 0;
 	for (i = 0; i < 8; i++) {
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 		if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA)) {
 			Data |= 1U;
 		}
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 	}
 
 	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
 	PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
 	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	if (bFinal) {
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	} else {
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	}
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 
 	return Data;
 }
 
 int I2C_Write(uint8_t Data)
 {
+	const uint8_t Polls = (gI2C_Mode == I2C_MODE_FAST) ? I2C_ACK_POLLS_FAST : I2C_ACK_POLLS_STANDARD;
 	uint8_t i;
 	int ret = -1;
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	for (i = 0; i < 8; i++) {
 		if ((Data & 0x80) == 0) {
 			GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
@@ -103,22 +162,22 @@ int I2C_Write(uint8_t Data)
 			GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 		}
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 	}
 
 	PORTCON_PORTA_IE |= PORTCON_PORTA_IE_A11_BITS_ENABLE;
 	PORTCON_PORTA_OD &= ~PORTCON_PORTA_OD_A11_MASK;
 	GPIOA->DIR &= ~GPIO_DIR_11_MASK;
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 
-	for (i = 0; i < 255; i++) {
+	for (i = 0; i < Polls; i++) {
 		if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA) == 0) {
 			ret = 0;
 			break;
@@ -126,7 +185,7 @@ int I2C_Write(uint8_t Data)
 	}
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
 	PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
 	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
@@ -146,11 +205,11 @@ int I2C_ReadBuffer(void *pBuffer, uint8_t Size)
 	}
 
 	for (i = 0; i < Size - 1; i++) {
-		SYSTICK_DelayUs(1);
+		I2C_Delay();
 		pData[i] = I2C_Read(false);
 	}
 
-	SYSTICK_DelayUs(1);
+	I2C_Delay();
 	pData[i++] = I2C_Read(true);
 
 	return Size;
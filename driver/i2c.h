@@ -28,6 +28,15 @@ enum {
 	I2C_READ = 1U,
 };
 
+enum I2C_Mode_t {
+	I2C_MODE_STANDARD = 0,	// SYSTICK_DelayUs(1) per edge, safe for every device on the bus
+	I2C_MODE_FAST,			// calibrated spin per edge, ~400kHz
+};
+typedef enum I2C_Mode_t I2C_Mode_t;
+
+void I2C_Calibrate(void);
+void I2C_SetMode(I2C_Mode_t Mode);
+
 void I2C_Start(void);
 void I2C_Stop(void);
 
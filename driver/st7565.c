@@ -19,7 +19,11 @@
 
 #include <stdint.h>
 #include <stdio.h>     // NULL
+#include <string.h>
 
+#ifdef ENABLE_LCD_DMA
+	#include "bsp/dp32g030/dma.h"
+#endif
 #include "bsp/dp32g030/gpio.h"
 #include "bsp/dp32g030/spi.h"
 #include "driver/gpio.h"
@@ -28,13 +32,158 @@
 #include "driver/system.h"
 #include "misc.h"
 
-uint8_t gStatusLine[128];
-uint8_t gFrameBuffer[7][128];
+uint8_t  gStatusLine[128];
+uint8_t  gFrameBuffer[7][128];
+uint16_t gBlitByteCount;
+
+// what the LCD shows of gFrameBuffer, a page is only compared once it is valid
+static uint8_t gShownFrameBuffer[7][128];
+static uint8_t gShownLines;   // one bit per gFrameBuffer line
+
+#ifdef ENABLE_LCD_DMA
+// DMA_CH2 feeds SPI0 one display page at a time, the CPU sets the page
+// address and the A0 line in between. The data comes from copies owned by
+// the driver so gFrameBuffer and gStatusLine can be redrawn straight away.
+
+#define ST7565_DMA_HSREQ DMA_CH_MOD_MD_SEL_BITS_HSREQ_MS4   // SPI0 TX
+
+static uint8_t       gStatusLineCopy[128];
+static uint8_t       gPendingPages;   // one bit per display page, 0 is the status line
+static uint8_t       gSpanFirst[8];
+static uint8_t       gSpanLast[8];
+static volatile bool gDmaBusy;
+
+static void DmaInit(void)
+{
+	DMA_CH2->MDADDR = (uint32_t)(uintptr_t)&SPI0->WDR;
+	DMA_CH2->MOD = 0
+		// Source
+		| DMA_CH_MOD_MS_ADDMOD_BITS_INCREMENT
+		| DMA_CH_MOD_MS_SIZE_BITS_8BIT
+		| DMA_CH_MOD_MS_SEL_BITS_SRAM
+		// Destination
+		| DMA_CH_MOD_MD_ADDMOD_BITS_NONE
+		| DMA_CH_MOD_MD_SIZE_BITS_8BIT
+		| ST7565_DMA_HSREQ
+		;
+
+	DMA_INTST = DMA_INTST_CH2_TC_INTST_BITS_SET;
+	DMA_CTR   = (DMA_CTR & ~DMA_CTR_DMAEN_MASK) | DMA_CTR_DMAEN_BITS_ENABLE;
+}
+
+static void QueuePage(unsigned int Page, unsigned int First, unsigned int Last)
+{
+	gSpanFirst[Page] = First;
+	gSpanLast[Page]  = Last;
+	gPendingPages   |= 1u << Page;
+}
+
+static void StartNextPage(void)
+{
+	const uint8_t *pData;
+	unsigned int   Page = 0;
+
+	while (!(gPendingPages & (1u << Page)))
+		Page++;
+	gPendingPages &= ~(1u << Page);
+
+	pData = (Page == 0) ? gStatusLineCopy : gShownFrameBuffer[Page - 1];
+
+	ST7565_SelectColumnAndLine(gSpanFirst[Page] + 4U, Page);
+	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+
+	DMA_CH2->MSADDR = (uint32_t)(uintptr_t)&pData[gSpanFirst[Page]];
+	DMA_CH2->CTR = 0
+		| DMA_CH_CTR_CH_EN_BITS_ENABLE
+		| (((gSpanLast[Page] - gSpanFirst[Page] - 1U) << DMA_CH_CTR_LENGTH_SHIFT) & DMA_CH_CTR_LENGTH_MASK)
+		| DMA_CH_CTR_LOOP_BITS_DISABLE
+		| DMA_CH_CTR_PRI_BITS_LOW
+		;
+}
+
+static void StartPages(void)
+{
+	if (gPendingPages == 0)
+		return;
+
+	SPI_ToggleMasterMode(&SPI0->CR, false);
+	ST7565_WriteByte(0x40);
+	SPI0->CR |= SPI_CR_TXDMAEN_MASK;
+	gDmaBusy = true;
+
+	StartNextPage();
+}
+
+/*
+Moves a DMA blit on to the next page once the current one is out, never waits
+for the transfer itself. Called from the main loop and the spectrum loop.
+*/
+void ST7565_Poll(void)
+{
+	if (!gDmaBusy)
+		return;
+
+	if ((DMA_INTST & DMA_INTST_CH2_TC_INTST_MASK) == DMA_INTST_CH2_TC_INTST_BITS_NOT_SET)
+		return;
+
+	DMA_INTST = DMA_INTST_CH2_TC_INTST_BITS_SET;
+
+	// the last bytes are still in the FIFO, A0 must not change under them
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+
+	if (gPendingPages != 0)
+	{
+		StartNextPage();
+		return;
+	}
+
+	SPI0->CR &= ~SPI_CR_TXDMAEN_MASK;
+	SPI_ToggleMasterMode(&SPI0->CR, true);
+	gDmaBusy = false;
+}
+
+bool ST7565_IsBusy(void)
+{
+	return gDmaBusy;
+}
+#else
+static void SendData(const uint8_t *pData, unsigned int Size)
+{
+	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+	for (unsigned int i = 0; i < Size; i++)
+	{
+		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
+		SPI0->WDR = pData[i];
+	}
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+}
+
+void ST7565_Poll(void)
+{
+}
+
+bool ST7565_IsBusy(void)
+{
+	return false;
+}
+#endif
+
+// the polled transfers share SPI0 with the DMA blit
+static void WaitIdle(void)
+{
+	while (ST7565_IsBusy())
+		ST7565_Poll();
+}
 
 void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap)
 {
 	unsigned int i;
 
+	WaitIdle();
+
+	if (Line > 0 && Line <= ARRAY_SIZE(gFrameBuffer))
+		gShownLines &= ~(1u << (Line - 1));
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
 	ST7565_SelectColumnAndLine(Column + 4U, Line);
@@ -65,6 +214,10 @@ void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const u
 
 void ST7565_BlitFullScreen(void)
 {
+#ifdef ENABLE_LCD_DMA
+	ST7565_InvalidateScreen();
+	ST7565_BlitDirty();
+#else
 	unsigned int Line;
 
 	SPI_ToggleMasterMode(&SPI0->CR, false);
@@ -73,17 +226,13 @@ void ST7565_BlitFullScreen(void)
 
 	for (Line = 0; Line < ARRAY_SIZE(gFrameBuffer); Line++)
 	{
-		unsigned int Column;
 		ST7565_SelectColumnAndLine(4, Line + 1);
-		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-		for (Column = 0; Column < ARRAY_SIZE(gFrameBuffer[0]); Column++)
-		{
-			while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {}
-			SPI0->WDR = gFrameBuffer[Line][Column];
-		}
-		SPI_WaitForUndocumentedTxFifoStatusBit();
+		SendData(gFrameBuffer[Line], ARRAY_SIZE(gFrameBuffer[0]));
 	}
 
+	memcpy(gShownFrameBuffer, gFrameBuffer, sizeof(gShownFrameBuffer));
+	gShownLines = (1u << ARRAY_SIZE(gFrameBuffer)) - 1;
+
 	#if 0
 		// whats the delay for I wonder, it holds things up :(
 		SYSTEM_DelayMs(20);
@@ -92,11 +241,82 @@ void ST7565_BlitFullScreen(void)
 	#endif
 
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+#endif
+}
+
+/*
+Sends only the columns of gFrameBuffer that changed since they were last sent,
+one span per line from the first to the last changed column
+*/
+void ST7565_BlitDirty(void)
+{
+	unsigned int Bytes = 0;
+
+	WaitIdle();
+
+	for (unsigned int Line = 0; Line < ARRAY_SIZE(gFrameBuffer); Line++)
+	{
+		const uint8_t *pNew   = gFrameBuffer[Line];
+		uint8_t       *pShown = gShownFrameBuffer[Line];
+		unsigned int   First  = 0;
+		unsigned int   Last   = ARRAY_SIZE(gFrameBuffer[0]);
+
+		if (gShownLines & (1u << Line))
+		{
+			while (First < Last && pNew[First] == pShown[First])
+				First++;
+			while (Last > First && pNew[Last - 1] == pShown[Last - 1])
+				Last--;
+			if (First == Last)
+				continue;
+		}
+
+#ifndef ENABLE_LCD_DMA
+		if (Bytes == 0)
+		{
+			SPI_ToggleMasterMode(&SPI0->CR, false);
+			ST7565_WriteByte(0x40);
+		}
+#endif
+
+		memcpy(pShown + First, pNew + First, Last - First);
+		gShownLines |= 1u << Line;
+		Bytes       += Last - First;
+
+#ifdef ENABLE_LCD_DMA
+		QueuePage(Line + 1, First, Last);
+#else
+		ST7565_SelectColumnAndLine(First + 4U, Line + 1);
+		SendData(pShown + First, Last - First);
+#endif
+	}
+
+#ifdef ENABLE_LCD_DMA
+	StartPages();   // returns straight away, ST7565_Poll() sends the rest
+#else
+	if (Bytes > 0)
+		SPI_ToggleMasterMode(&SPI0->CR, true);
+#endif
+
+	gBlitByteCount = Bytes;
+}
+
+// the LCD contents are unknown, the next ST7565_BlitDirty() sends every line
+void ST7565_InvalidateScreen(void)
+{
+	gShownLines = 0;
 }
 
 void ST7565_BlitStatusLine(void)
 {	// the top small text line on the display
 
+	WaitIdle();
+
+#ifdef ENABLE_LCD_DMA
+	memcpy(gStatusLineCopy, gStatusLine, sizeof(gStatusLineCopy));
+	QueuePage(0, 0, ARRAY_SIZE(gStatusLineCopy));
+	StartPages();
+#else
 	unsigned int i;
 
 	SPI_ToggleMasterMode(&SPI0->CR, false);
@@ -116,6 +336,7 @@ void ST7565_BlitStatusLine(void)
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+#endif
 }
 
 void ST7565_FillScreen(uint8_t Value)
@@ -124,6 +345,8 @@ void ST7565_FillScreen(uint8_t Value)
 
 	// reset some of the displays settings to try and overcome the radios hardware problem - RF corrupting the display
 	ST7565_Init(false);
+
+	ST7565_InvalidateScreen();
 	
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 
@@ -210,7 +433,12 @@ uint8_t cmds[] = {
 
 void ST7565_Init(const bool full)
 {
+	WaitIdle();
+
 	if (full) {
+		#ifdef ENABLE_LCD_DMA
+			DmaInit();
+		#endif
 		SPI0_Init();
 		ST7565_HardwareReset();
 		SPI_ToggleMasterMode(&SPI0->CR, false);
@@ -246,6 +474,9 @@ void ST7565_Init(const bool full)
 
 void ST7565_FixInterfGlitch(void)
 {
+	WaitIdle();
+	ST7565_InvalidateScreen();
+
 	SPI_ToggleMasterMode(&SPI0->CR, false);
 	for(uint8_t i = 0; i < ARRAY_SIZE(cmds); i++)
 		ST7565_WriteByte(cmds[i]);
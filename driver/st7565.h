@@ -26,11 +26,16 @@
 #define LCD_WIDTH       128
 #define LCD_HEIGHT       64
 
-extern uint8_t gStatusLine[128];
-extern uint8_t gFrameBuffer[7][128];
+extern uint8_t  gStatusLine[128];
+extern uint8_t  gFrameBuffer[7][128];
+extern uint16_t gBlitByteCount;   // data bytes sent by the last ST7565_BlitDirty()
 
 void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap);
 void ST7565_BlitFullScreen(void);
+void ST7565_BlitDirty(void);
+void ST7565_InvalidateScreen(void);
+void ST7565_Poll(void);
+bool ST7565_IsBusy(void);
 void ST7565_BlitStatusLine(void);
 void ST7565_FillScreen(uint8_t Value);
 void ST7565_Init(const bool full);
@@ -46,3 +46,14 @@ void SYSTICK_DelayUs(uint32_t Delay)
 	} while (i < ticks);
 }
 
+uint32_t SYSTICK_GetValue(void)
+{
+	return SysTick->VAL;
+}
+
+// SysTick counts down from LOAD, only one reload may happen in between
+uint32_t SYSTICK_CyclesSince(uint32_t Start)
+{
+	const uint32_t Now = SysTick->VAL;
+	return (Start >= Now) ? Start - Now : Start + SysTick->LOAD + 1 - Now;
+}
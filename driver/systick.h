@@ -24,6 +24,8 @@
 
 void SYSTICK_Init(void);
 void SYSTICK_DelayUs(uint32_t Delay);
+uint32_t SYSTICK_GetValue(void);
+uint32_t SYSTICK_CyclesSince(uint32_t Start);
 
 #endif
 
@@ -29,6 +29,23 @@
 static bool UART_IsLogEnabled;
 uint8_t UART_DMA_Buffer[256];
 
+static uint32_t gUART_Frequency;
+static uint32_t gUART_BaudRate;
+
+// transmit ring drained by DMA_CH1, RX owns DMA_CH0
+#define UART_TX_RING_SIZE 256U
+
+static uint8_t           gUART_TxRing[UART_TX_RING_SIZE];
+static volatile uint16_t gUART_TxHead;    // next byte written by UART_Send
+static volatile uint16_t gUART_TxTail;    // first byte not yet handed to the DMA
+static volatile uint16_t gUART_TxChunk;   // bytes the DMA is moving right now, 0 = idle
+
+// the stock divider runs 38400 baud at Frequency / 39053, keep the same correction for every rate
+static uint32_t BaudDivider(uint32_t BaudRate)
+{
+	return (uint32_t)(((uint64_t)gUART_Frequency * UART_BAUD_DEFAULT) / ((uint64_t)BaudRate * 39053U));
+}
+
 void UART_Init(void)
 {
 	uint32_t Delta;
@@ -45,8 +62,11 @@ void UART_Init(void)
 		Frequency = 48000000U - Frequency;
 	}
 
-	UART1->BAUD = Frequency / 39053U;
-	UART1->CTRL = UART_CTRL_RXEN_BITS_ENABLE | UART_CTRL_TXEN_BITS_ENABLE | UART_CTRL_RXDMAEN_BITS_ENABLE;
+	gUART_Frequency = Frequency;
+	gUART_BaudRate  = UART_BAUD_DEFAULT;
+
+	UART1->BAUD = BaudDivider(gUART_BaudRate);
+	UART1->CTRL = UART_CTRL_RXEN_BITS_ENABLE | UART_CTRL_TXEN_BITS_ENABLE | UART_CTRL_RXDMAEN_BITS_ENABLE | UART_CTRL_TXDMAEN_BITS_ENABLE;
 	UART1->RXTO = 4;
 	UART1->FC = 0;
 	UART1->FIFO = UART_FIFO_RF_LEVEL_BITS_8_BYTE | UART_FIFO_RF_CLR_BITS_ENABLE | UART_FIFO_TF_CLR_BITS_ENABLE;
@@ -66,6 +86,21 @@ void UART_Init(void)
 		| DMA_CH_MOD_MD_SIZE_BITS_8BIT
 		| DMA_CH_MOD_MD_SEL_BITS_SRAM
 		;
+	DMA_CH1->MDADDR = (uint32_t)(uintptr_t)&UART1->TDR;
+	DMA_CH1->MOD = 0
+		// Source
+		| DMA_CH_MOD_MS_ADDMOD_BITS_INCREMENT
+		| DMA_CH_MOD_MS_SIZE_BITS_8BIT
+		| DMA_CH_MOD_MS_SEL_BITS_SRAM
+		// Destination
+		| DMA_CH_MOD_MD_ADDMOD_BITS_NONE
+		| DMA_CH_MOD_MD_SIZE_BITS_8BIT
+		| DMA_CH_MOD_MD_SEL_BITS_HSREQ_MS0
+		;
+	gUART_TxHead  = 0;
+	gUART_TxTail  = 0;
+	gUART_TxChunk = 0;
+
 	DMA_INTEN = 0;
 	DMA_INTST = 0
 		| DMA_INTST_CH0_TC_INTST_BITS_SET
@@ -90,15 +125,159 @@ void UART_Init(void)
 	UART1->CTRL |= UART_CTRL_UARTEN_BITS_ENABLE;
 }
 
+bool UART_IsBaudRateSupported(uint32_t BaudRate)
+{
+	switch (BaudRate)
+	{
+		case UART_BAUD_DEFAULT:
+		case 115200:
+		case 230400:
+		case 460800:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+Changes the line rate once everything queued has left the shift register
+returns false if the rate is not supported
+*/
+bool UART_SetBaudRate(uint32_t BaudRate)
+{
+	if (!UART_IsBaudRateSupported(BaudRate))
+		return false;
+
+	if (BaudRate == gUART_BaudRate)
+		return true;
+
+	UART_Flush();
+
+	while ((UART1->IF & UART_IF_TXFIFO_EMPTY_MASK) == UART_IF_TXFIFO_EMPTY_BITS_NOT_SET ||
+	       (UART1->IF & UART_IF_TXBUSY_MASK) != UART_IF_TXBUSY_BITS_NOT_SET) {
+	}
+
+	UART1->CTRL = (UART1->CTRL & ~UART_CTRL_UARTEN_MASK) | UART_CTRL_UARTEN_BITS_DISABLE;
+	UART1->BAUD = BaudDivider(BaudRate);
+	UART1->CTRL |= UART_CTRL_UARTEN_BITS_ENABLE;
+
+	gUART_BaudRate = BaudRate;
+
+	return true;
+}
+
+uint32_t UART_GetBaudRate(void)
+{
+	return gUART_BaudRate;
+}
+
+static uint16_t TxFree(void)
+{
+	// the bytes in flight sit just before the tail
+	return UART_TX_RING_SIZE - 1U - gUART_TxChunk - ((gUART_TxHead - gUART_TxTail) & (UART_TX_RING_SIZE - 1U));
+}
+
+uint16_t UART_TxSpace(void)
+{
+	UART_Poll();
+	return TxFree();
+}
+
+/*
+Retires the finished DMA transfer and starts the next one, never waits.
+Called on every enqueue and from the main loop.
+*/
+void UART_Poll(void)
+{
+	uint16_t Tail;
+	uint16_t Head;
+	uint16_t Size;
+
+	if (gUART_TxChunk != 0) {
+		if ((DMA_INTST & DMA_INTST_CH1_TC_INTST_MASK) == DMA_INTST_CH1_TC_INTST_BITS_NOT_SET)
+			return;
+
+		DMA_INTST = DMA_INTST_CH1_TC_INTST_BITS_SET;
+		gUART_TxChunk = 0;
+	}
+
+	Tail = gUART_TxTail;
+	Head = gUART_TxHead;
+	if (Head == Tail)
+		return;
+
+	// one contiguous run per transfer, the wrapped part goes next time
+	Size = (Head > Tail) ? (uint16_t)(Head - Tail) : (uint16_t)(UART_TX_RING_SIZE - Tail);
+
+	gUART_TxChunk = Size;
+	gUART_TxTail  = (Tail + Size) & (UART_TX_RING_SIZE - 1U);
+
+	DMA_CH1->MSADDR = (uint32_t)(uintptr_t)&gUART_TxRing[Tail];
+	DMA_CH1->CTR = 0
+		| DMA_CH_CTR_CH_EN_BITS_ENABLE
+		| (((Size - 1U) << DMA_CH_CTR_LENGTH_SHIFT) & DMA_CH_CTR_LENGTH_MASK)
+		| DMA_CH_CTR_LOOP_BITS_DISABLE
+		| DMA_CH_CTR_PRI_BITS_LOW
+		;
+}
+
+/*
+Queues the bytes for transmission if they all fit, the caller's buffer may be reused straight away
+returns false (nothing queued) if the ring is too full
+*/
+bool UART_TrySend(const void *pBuffer, uint32_t Size)
+{
+	const uint8_t *pData = (const uint8_t *)pBuffer;
+	uint16_t       Head;
+
+	UART_Poll();
+
+	if (Size > TxFree())
+		return false;
+
+	Head = gUART_TxHead;
+	while (Size--) {
+		gUART_TxRing[Head] = *pData++;
+		Head = (Head + 1U) & (UART_TX_RING_SIZE - 1U);
+	}
+	gUART_TxHead = Head;
+
+	UART_Poll();
+
+	return true;
+}
+
+// queues the bytes, only waits when the ring is full
 void UART_Send(const void *pBuffer, uint32_t Size)
 {
 	const uint8_t *pData = (const uint8_t *)pBuffer;
-	uint32_t i;
 
-	for (i = 0; i < Size; i++) {
-		UART1->TDR = pData[i];
-		while ((UART1->IF & UART_IF_TXFIFO_FULL_MASK) != UART_IF_TXFIFO_FULL_BITS_NOT_SET) {
+	while (Size > 0) {
+		uint32_t Chunk = TxFree();
+
+		if (Chunk == 0) {
+			UART_Poll();
+			continue;
 		}
+		if (Chunk > Size)
+			Chunk = Size;
+
+		UART_TrySend(pData, Chunk);
+		pData += Chunk;
+		Size  -= Chunk;
+	}
+}
+
+bool UART_IsTxIdle(void)
+{
+	UART_Poll();
+	return gUART_TxChunk == 0 && gUART_TxHead == gUART_TxTail;
+}
+
+// waits until everything queued has been handed to the UART
+void UART_Flush(void)
+{
+	while (!UART_IsTxIdle()) {
 	}
 }
 
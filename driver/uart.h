@@ -21,12 +21,23 @@
 #ifndef DRIVER_UART_H
 #define DRIVER_UART_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#define UART_BAUD_DEFAULT 38400U
+
 extern uint8_t UART_DMA_Buffer[256];
 
 void UART_Init(void);
+bool UART_IsBaudRateSupported(uint32_t BaudRate);
+bool UART_SetBaudRate(uint32_t BaudRate);
+uint32_t UART_GetBaudRate(void);
+void UART_Poll(void);
+uint16_t UART_TxSpace(void);
+bool UART_TrySend(const void *pBuffer, uint32_t Size);
 void UART_Send(const void *pBuffer, uint32_t Size);
+bool UART_IsTxIdle(void);
+void UART_Flush(void);
 void UART_LogSend(const void *pBuffer, uint32_t Size);
 #ifdef ENABLE_MESSENGER_UART
     void UART_printf(const char *str, ...);
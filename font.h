@@ -31,5 +31,21 @@ extern const uint8_t gFontSmall[95 - 1][6];
 	extern const uint8_t gFontSmallBold[95 - 1][6];
 #endif
 
+#ifdef ENABLE_PROPORTIONAL_FONT
+	// font_atlas.c, generated by utils/font_atlas.py
+	typedef struct {
+		const uint8_t  *pColumns;   // the packed glyph columns, one strip of Stride per row
+		const uint16_t *pOffset;    // glyph i is pOffset[i] up to pOffset[i + 1] in each strip
+		uint16_t        Stride;
+		uint8_t         Space;      // width of ' ' and of characters without a glyph
+	} FontAtlas_t;
+
+	extern const FontAtlas_t gFontBigAtlas;
+	extern const FontAtlas_t gFontSmallAtlas;
+	#ifdef ENABLE_SMALL_BOLD
+		extern const FontAtlas_t gFontSmallBoldAtlas;
+	#endif
+#endif
+
 #endif
 
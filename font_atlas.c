@@ -0,0 +1,191 @@
+// generated by utils/font_atlas.py from font.c, do not edit
+
+#include "font.h"
+
+#ifdef ENABLE_PROPORTIONAL_FONT
+
+static const uint8_t gFontBigColumns[2 * 589] =
+{
+	0xFC, 0xFC, 0x0F, 0x1F, 0x00, 0x00, 0x1F, 0x0F, 0x20, 0xF8, 0xF8, 0x20, 0xF8, 0xF8, 0x20, 0x70,
+	0xF8, 0x88, 0x8E, 0x8E, 0x98, 0x10, 0x30, 0x30, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x80, 0xD8, 0x7C,
+	0xE4, 0xBC, 0xD8, 0x40, 0x10, 0x1F, 0x0F, 0xF0, 0xF8, 0x0C, 0x04, 0x04, 0x0C, 0xF8, 0xF0, 0x80,
+	0xA0, 0xE0, 0xC0, 0xE0, 0xA0, 0x80, 0x80, 0xE0, 0xE0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x30, 0xF8, 0xFC,
+	0x84, 0xC4, 0x64, 0xFC, 0xF8, 0x00, 0x10, 0x18, 0xFC, 0xFC, 0x00, 0x00, 0x18, 0x1C, 0x04, 0x84,
+	0xC4, 0x7C, 0x38, 0x18, 0x1C, 0x44, 0x44, 0x44, 0xFC, 0xB8, 0x80, 0xC0, 0x60, 0x30, 0x18, 0xFC,
+	0xFC, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0xC4, 0x84, 0xF0, 0xF8, 0x4C, 0x44, 0x44, 0xC4, 0x80, 0x04,
+	0x04, 0x04, 0x84, 0xE4, 0x7C, 0x1C, 0xB8, 0xFC, 0x44, 0x44, 0x44, 0xFC, 0xB8, 0x78, 0xFC, 0x84,
+	0x84, 0x84, 0xFC, 0xF8, 0x30, 0x30, 0x00, 0x30, 0x30, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x08, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x08, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x38, 0x3C, 0x04, 0x84,
+	0xC4, 0x7C, 0x38, 0xF0, 0xF8, 0x08, 0xC8, 0xC8, 0xF8, 0xF0, 0xF8, 0xFC, 0x84, 0x84, 0x84, 0xFC,
+	0xF8, 0xFC, 0xFC, 0x44, 0x44, 0x44, 0xFC, 0xB8, 0xF8, 0xFC, 0x04, 0x04, 0x04, 0x1C, 0x18, 0xFC,
+	0xFC, 0x04, 0x04, 0x0C, 0xF8, 0xF0, 0xFC, 0xFC, 0x44, 0x44, 0x44, 0x04, 0x04, 0xFC, 0xFC, 0x44,
+	0x44, 0x44, 0x04, 0x04, 0xF8, 0xFC, 0x04, 0x84, 0x84, 0x9C, 0x98, 0xFC, 0xFC, 0x40, 0x40, 0x40,
+	0xFC, 0xFC, 0x04, 0xFC, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFC, 0xFC, 0x04, 0xFC, 0xFC, 0xE0,
+	0x30, 0x18, 0x0C, 0x04, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x18, 0x70, 0x18,
+	0xFC, 0xFC, 0xFC, 0xFC, 0x60, 0xC0, 0x80, 0xFC, 0xFC, 0xF8, 0xFC, 0x04, 0x04, 0x04, 0xFC, 0xF8,
+	0xFC, 0xFC, 0x84, 0x84, 0x84, 0xFC, 0x78, 0xF8, 0xFC, 0x04, 0x04, 0x04, 0xFC, 0xF8, 0xFC, 0xFC,
+	0x84, 0x84, 0x84, 0xFC, 0x78, 0x38, 0x7C, 0x44, 0x44, 0x44, 0xCC, 0x88, 0x04, 0x04, 0xFC, 0xFC,
+	0x04, 0x04, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x7C, 0xFC, 0x80, 0x00, 0x80, 0xFC, 0x7C,
+	0xFC, 0xFC, 0x00, 0x80, 0x00, 0xFC, 0xFC, 0x0C, 0x3C, 0xF0, 0xC0, 0xF0, 0x3C, 0x0C, 0x3C, 0x7C,
+	0xC0, 0xC0, 0x7C, 0x3C, 0x04, 0x04, 0x84, 0xC4, 0x64, 0x3C, 0x1C, 0xFC, 0xFC, 0x04, 0x04, 0x38,
+	0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x04, 0x04, 0xFC, 0xFC, 0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x04, 0x00, 0xA0, 0xA0, 0xA0, 0xA0,
+	0xE0, 0xC0, 0xFC, 0xFC, 0x20, 0x20, 0x20, 0xE0, 0xC0, 0xC0, 0xE0, 0x20, 0x20, 0x20, 0x60, 0x40,
+	0xC0, 0xE0, 0x20, 0x20, 0x20, 0xFC, 0xFC, 0xC0, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0xC0, 0x20, 0x20,
+	0xF8, 0xFC, 0x24, 0x24, 0x04, 0xC0, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0xFC, 0xFC, 0x20, 0x20,
+	0x20, 0xE0, 0xC0, 0x20, 0xEC, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEC, 0xEC, 0xFC, 0xFC, 0x00,
+	0x80, 0xC0, 0x60, 0x20, 0x04, 0xFC, 0xFC, 0x00, 0xE0, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0xC0, 0xE0,
+	0xE0, 0x20, 0x20, 0x20, 0xE0, 0xC0, 0xC0, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0xC0, 0xE0, 0xE0, 0x20,
+	0x20, 0x20, 0xE0, 0xC0, 0xC0, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x20, 0x20,
+	0x20, 0x20, 0xC0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xFC, 0xFC, 0x20, 0x20, 0x00,
+	0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0,
+	0x00, 0x80, 0x00, 0xE0, 0xE0, 0x60, 0xE0, 0x80, 0x00, 0x80, 0xE0, 0x60, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0xA0, 0xE0, 0x60, 0x20, 0x40, 0xF8, 0xBC, 0x04, 0x04, 0xBC,
+	0xBC, 0x04, 0x04, 0xBC, 0xF8, 0x40, 0x08, 0x0C, 0x04, 0x0C, 0x08, 0x0C, 0x04,
+	0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x02, 0x04,
+	0x0C, 0x08, 0x38, 0x38, 0x0F, 0x07, 0x0C, 0x06, 0x03, 0x01, 0x00, 0x0C, 0x0C, 0x07, 0x0F, 0x08,
+	0x08, 0x07, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0C, 0x08, 0x08, 0x0C, 0x07, 0x03, 0x00,
+	0x02, 0x03, 0x01, 0x03, 0x02, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x10, 0x1E, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x07, 0x0F,
+	0x09, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x0C, 0x0E, 0x0B, 0x09,
+	0x08, 0x08, 0x08, 0x06, 0x0E, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F,
+	0x0F, 0x04, 0x0C, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00,
+	0x00, 0x0E, 0x0F, 0x01, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x08, 0x08,
+	0x08, 0x0C, 0x07, 0x03, 0x06, 0x06, 0x08, 0x0E, 0x06, 0x00, 0x01, 0x03, 0x06, 0x0C, 0x08, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0D,
+	0x0D, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x0B, 0x0B, 0x0B, 0x01, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0E, 0x06, 0x0F,
+	0x0F, 0x08, 0x08, 0x0C, 0x07, 0x03, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x0F, 0x0F, 0x00, 0x00, 0x00,
+	0x0F, 0x0F, 0x08, 0x0F, 0x0F, 0x08, 0x06, 0x0E, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x0F, 0x0F, 0x01,
+	0x03, 0x06, 0x0C, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x0F, 0x00, 0x00, 0x00,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x01, 0x0F, 0x0F, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07,
+	0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x0C, 0x0C, 0x1F, 0x17, 0x0F, 0x0F,
+	0x01, 0x03, 0x06, 0x0C, 0x08, 0x06, 0x0E, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x00, 0x0F, 0x0F,
+	0x00, 0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x03, 0x0F, 0x0C, 0x0F, 0x03, 0x00,
+	0x0F, 0x0F, 0x06, 0x03, 0x06, 0x0F, 0x0F, 0x0C, 0x0F, 0x03, 0x00, 0x03, 0x0F, 0x0C, 0x00, 0x00,
+	0x0F, 0x0F, 0x00, 0x00, 0x0E, 0x0F, 0x09, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x00,
+	0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x08, 0x08, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x08, 0x08,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0C, 0x04,
+	0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x0F, 0x07, 0x0F, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00, 0x00,
+	0x0F, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x4F, 0x48, 0x48, 0x48, 0x7F, 0x3F, 0x0F, 0x0F, 0x00, 0x00,
+	0x00, 0x0F, 0x0F, 0x08, 0x0F, 0x0F, 0x08, 0x30, 0x70, 0x40, 0x40, 0x7F, 0x3F, 0x0F, 0x0F, 0x01,
+	0x03, 0x06, 0x0C, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x0F, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x7F, 0x7F, 0x08,
+	0x08, 0x08, 0x0F, 0x07, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x7F, 0x7F, 0x0F, 0x0F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0F, 0x06, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x08, 0x08,
+	0x07, 0x0F, 0x08, 0x08, 0x08, 0x0F, 0x0F, 0x00, 0x03, 0x0F, 0x0C, 0x0F, 0x03, 0x00, 0x07, 0x0F,
+	0x08, 0x0F, 0x08, 0x0F, 0x07, 0x0C, 0x0E, 0x03, 0x01, 0x03, 0x0E, 0x0C, 0x07, 0x4F, 0x48, 0x48,
+	0x48, 0x7F, 0x3F, 0x0C, 0x0E, 0x0B, 0x09, 0x08, 0x08, 0x08, 0x00, 0x07, 0x0F, 0x08, 0x08, 0x0F,
+	0x0F, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint16_t gFontBigOffset[95] =
+{
+	0, 2, 8, 15, 22, 29, 36, 39, 43, 47, 53, 59, 62, 69, 71, 78,
+	85, 92, 99, 106, 113, 120, 127, 134, 141, 148, 150, 153, 159, 166, 172, 179,
+	186, 193, 200, 207, 214, 221, 228, 235, 242, 246, 253, 260, 267, 274, 281, 288,
+	295, 302, 309, 316, 322, 329, 336, 343, 350, 356, 363, 367, 374, 378, 385, 392,
+	395, 402, 409, 416, 423, 430, 437, 444, 451, 455, 461, 468, 472, 479, 486, 493,
+	500, 507, 514, 521, 528, 535, 542, 549, 556, 563, 570, 575, 577, 582, 589,
+};
+
+const FontAtlas_t gFontBigAtlas = { gFontBigColumns, gFontBigOffset, 589, 4 };
+
+static const uint8_t gFontSmallColumns[1 * 460] =
+{
+	0x5E, 0x06, 0x00, 0x06, 0x14, 0x3E, 0x14, 0x3E, 0x14, 0x26, 0x49, 0x7F, 0x49, 0x32, 0x63, 0x13,
+	0x08, 0x04, 0x62, 0x61, 0x30, 0x4B, 0x4D, 0x55, 0x22, 0x50, 0x07, 0x07, 0x1C, 0x22, 0x41, 0x41,
+	0x22, 0x1C, 0x2A, 0x1C, 0x1C, 0x2A, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x40, 0x60, 0x20, 0x08, 0x08,
+	0x08, 0x08, 0x60, 0x60, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x41, 0x41, 0x41, 0x41, 0x3E,
+	0x00, 0x40, 0x42, 0x7F, 0x40, 0x40, 0x62, 0x51, 0x51, 0x49, 0x49, 0x46, 0x22, 0x41, 0x49, 0x49,
+	0x49, 0x36, 0x18, 0x14, 0x12, 0x11, 0x7F, 0x10, 0x27, 0x45, 0x45, 0x45, 0x45, 0x39, 0x3E, 0x49,
+	0x49, 0x49, 0x49, 0x32, 0x01, 0x01, 0x71, 0x09, 0x05, 0x03, 0x36, 0x49, 0x49, 0x49, 0x49, 0x36,
+	0x46, 0x49, 0x49, 0x49, 0x29, 0x1E, 0x6C, 0x6C, 0x40, 0x6C, 0x2C, 0x08, 0x14, 0x22, 0x41, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x41, 0x22, 0x14, 0x08, 0x02, 0x01, 0x51, 0x09, 0x06, 0x30, 0x4A, 0x4A,
+	0x52, 0x3C, 0x7E, 0x09, 0x09, 0x09, 0x09, 0x7E, 0x7F, 0x49, 0x49, 0x49, 0x49, 0x36, 0x3E, 0x41,
+	0x41, 0x41, 0x41, 0x22, 0x7F, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x49, 0x49, 0x49, 0x49, 0x41,
+	0x7F, 0x09, 0x09, 0x09, 0x09, 0x01, 0x3E, 0x41, 0x49, 0x49, 0x49, 0x3A, 0x7F, 0x08, 0x08, 0x08,
+	0x08, 0x7F, 0x41, 0x41, 0x7F, 0x41, 0x41, 0x20, 0x41, 0x41, 0x3F, 0x01, 0x01, 0x7F, 0x08, 0x0C,
+	0x12, 0x21, 0x40, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x02, 0x04, 0x04, 0x02, 0x7F, 0x7F,
+	0x02, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x09, 0x09, 0x09, 0x09,
+	0x06, 0x3E, 0x41, 0x51, 0x61, 0x41, 0x3E, 0x7F, 0x09, 0x09, 0x19, 0x29, 0x46, 0x26, 0x49, 0x49,
+	0x49, 0x49, 0x32, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x07, 0x38,
+	0x40, 0x40, 0x38, 0x07, 0x3F, 0x40, 0x30, 0x30, 0x40, 0x3F, 0x63, 0x14, 0x08, 0x08, 0x14, 0x63,
+	0x07, 0x08, 0x70, 0x08, 0x07, 0x61, 0x51, 0x49, 0x45, 0x43, 0x41, 0x7F, 0x41, 0x41, 0x01, 0x02,
+	0x04, 0x08, 0x10, 0x60, 0x41, 0x41, 0x7F, 0x04, 0x02, 0x01, 0x02, 0x04, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x03, 0x07, 0x06, 0x20, 0x54, 0x54, 0x54, 0x78, 0x7F, 0x44, 0x44, 0x44, 0x38, 0x38,
+	0x44, 0x44, 0x44, 0x28, 0x38, 0x44, 0x44, 0x44, 0x7F, 0x38, 0x54, 0x54, 0x54, 0x48, 0x7C, 0x0A,
+	0x0A, 0x0A, 0x02, 0x58, 0x54, 0x54, 0x54, 0x3C, 0x7F, 0x04, 0x04, 0x04, 0x78, 0x7A, 0x20, 0x40,
+	0x40, 0x3D, 0x7F, 0x10, 0x28, 0x44, 0x3F, 0x40, 0x7C, 0x08, 0x10, 0x10, 0x08, 0x7C, 0x7C, 0x04,
+	0x04, 0x04, 0x78, 0x38, 0x44, 0x44, 0x44, 0x38, 0x7C, 0x14, 0x14, 0x14, 0x08, 0x08, 0x14, 0x14,
+	0x14, 0x7C, 0x40, 0x7C, 0x04, 0x04, 0x04, 0x08, 0x08, 0x54, 0x54, 0x54, 0x20, 0x3F, 0x44, 0x44,
+	0x44, 0x40, 0x3C, 0x40, 0x40, 0x40, 0x3C, 0x0C, 0x30, 0x40, 0x30, 0x0C, 0x3C, 0x40, 0x30, 0x40,
+	0x3C, 0x44, 0x28, 0x10, 0x28, 0x44, 0x0C, 0x50, 0x50, 0x50, 0x3C, 0x44, 0x64, 0x54, 0x4C, 0x44,
+	0x08, 0x36, 0x41, 0x7F, 0x41, 0x36, 0x08, 0x04, 0x02, 0x04, 0x08, 0x04,
+};
+
+static const uint16_t gFontSmallOffset[95] =
+{
+	0, 1, 4, 9, 14, 20, 26, 28, 31, 34, 38, 43, 46, 50, 52, 58,
+	64, 70, 76, 82, 88, 94, 100, 106, 112, 118, 120, 123, 127, 132, 136, 141,
+	146, 152, 158, 164, 170, 176, 182, 188, 194, 199, 205, 211, 217, 223, 229, 235,
+	241, 247, 253, 259, 264, 270, 276, 282, 288, 293, 299, 302, 308, 311, 316, 322,
+	325, 330, 335, 340, 345, 350, 355, 360, 365, 366, 370, 374, 376, 382, 387, 392,
+	397, 403, 408, 413, 418, 423, 428, 433, 438, 443, 448, 451, 452, 455, 460,
+};
+
+const FontAtlas_t gFontSmallAtlas = { gFontSmallColumns, gFontSmallOffset, 460, 3 };
+
+#ifdef ENABLE_SMALL_BOLD
+static const uint8_t gFontSmallBoldColumns[1 * 496] =
+{
+	0x5E, 0x5E, 0x06, 0x06, 0x00, 0x06, 0x06, 0x14, 0x3E, 0x14, 0x3E, 0x14, 0x2E, 0x6B, 0x7F, 0x6B,
+	0x3A, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x30, 0x4B, 0x4D, 0x55, 0x22, 0x50, 0x07, 0x07, 0x1C,
+	0x3E, 0x63, 0x41, 0x41, 0x63, 0x3E, 0x1C, 0x2A, 0x1C, 0x1C, 0x2A, 0x18, 0x18, 0x7E, 0x7E, 0x18,
+	0x18, 0x40, 0x60, 0x20, 0x18, 0x18, 0x18, 0x18, 0x60, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+	0x3E, 0x7F, 0x63, 0x63, 0x7F, 0x3E, 0x64, 0x66, 0x7F, 0x7F, 0x60, 0x60, 0x62, 0x73, 0x7B, 0x7B,
+	0x6F, 0x66, 0x63, 0x63, 0x6B, 0x6B, 0x7F, 0x36, 0x38, 0x3C, 0x36, 0x7F, 0x7F, 0x30, 0x6F, 0x6F,
+	0x6B, 0x6B, 0x7B, 0x33, 0x3E, 0x7F, 0x6B, 0x6B, 0x7B, 0x32, 0x03, 0x03, 0x73, 0x7B, 0x0F, 0x07,
+	0x36, 0x7F, 0x6B, 0x6B, 0x7F, 0x36, 0x06, 0x6F, 0x6B, 0x6B, 0x7F, 0x3E, 0x6C, 0x6C, 0x40, 0x6C,
+	0x2C, 0x08, 0x14, 0x22, 0x41, 0x36, 0x36, 0x36, 0x36, 0x36, 0x41, 0x22, 0x14, 0x08, 0x06, 0x07,
+	0x53, 0x5B, 0x1F, 0x0E, 0x30, 0x7B, 0x6B, 0x7B, 0x7F, 0x3E, 0x7E, 0x7F, 0x1B, 0x1B, 0x7F, 0x7E,
+	0x7F, 0x7F, 0x6B, 0x6B, 0x7F, 0x36, 0x3E, 0x7F, 0x63, 0x63, 0x63, 0x36, 0x7F, 0x7F, 0x63, 0x63,
+	0x7F, 0x3E, 0x7F, 0x7F, 0x6B, 0x6B, 0x6B, 0x63, 0x7F, 0x7F, 0x1B, 0x1B, 0x1B, 0x03, 0x3E, 0x7F,
+	0x63, 0x6B, 0x7B, 0x3A, 0x7F, 0x7F, 0x0C, 0x0C, 0x7F, 0x7F, 0x63, 0x63, 0x7F, 0x7F, 0x63, 0x63,
+	0x30, 0x73, 0x63, 0x7F, 0x3F, 0x03, 0x7F, 0x7F, 0x1C, 0x36, 0x63, 0x41, 0x7F, 0x7F, 0x60, 0x60,
+	0x60, 0x60, 0x7F, 0x7F, 0x06, 0x06, 0x7F, 0x7F, 0x7F, 0x7F, 0x0C, 0x18, 0x7F, 0x7F, 0x3E, 0x7F,
+	0x63, 0x63, 0x7F, 0x3E, 0x7F, 0x7F, 0x1B, 0x1B, 0x1F, 0x0E, 0x3E, 0x7F, 0x63, 0x73, 0x7F, 0x7E,
+	0x7F, 0x7F, 0x1B, 0x3B, 0x7F, 0x66, 0x66, 0x6F, 0x6B, 0x6B, 0x7B, 0x33, 0x03, 0x03, 0x7F, 0x7F,
+	0x03, 0x03, 0x3F, 0x7F, 0x60, 0x60, 0x7F, 0x3F, 0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x3F, 0x7F,
+	0x30, 0x30, 0x7F, 0x3F, 0x63, 0x77, 0x1C, 0x1C, 0x77, 0x63, 0x07, 0x0F, 0x78, 0x78, 0x0F, 0x07,
+	0x63, 0x73, 0x7B, 0x6F, 0x67, 0x63, 0x7F, 0x7F, 0x63, 0x63, 0x01, 0x02, 0x04, 0x08, 0x10, 0x60,
+	0x63, 0x63, 0x7F, 0x7F, 0x0C, 0x0E, 0x03, 0x03, 0x0E, 0x0C, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x03, 0x07, 0x06, 0x20, 0x76, 0x56, 0x56, 0x7E, 0x3C, 0x7F, 0x7F, 0x6C, 0x6C, 0x7C, 0x38, 0x38,
+	0x7C, 0x6C, 0x6C, 0x6C, 0x38, 0x7C, 0x6C, 0x6C, 0x7F, 0x7F, 0x3C, 0x7E, 0x56, 0x56, 0x5E, 0x0C,
+	0x7E, 0x7F, 0x1B, 0x1B, 0x02, 0x0C, 0x5E, 0x56, 0x56, 0x7E, 0x3C, 0x7F, 0x7F, 0x0C, 0x0C, 0x7C,
+	0x78, 0x7A, 0x7A, 0x30, 0x60, 0x60, 0x7D, 0x3D, 0x7F, 0x7F, 0x18, 0x3C, 0x7E, 0x66, 0x3F, 0x7F,
+	0x40, 0x7C, 0x7C, 0x18, 0x18, 0x7C, 0x7C, 0x7C, 0x7C, 0x0C, 0x0C, 0x7C, 0x78, 0x3C, 0x7E, 0x66,
+	0x66, 0x7E, 0x3C, 0x7E, 0x7E, 0x36, 0x36, 0x3E, 0x1C, 0x1C, 0x3E, 0x36, 0x7E, 0x7E, 0x60, 0x7C,
+	0x7C, 0x0C, 0x0C, 0x18, 0x4C, 0x5E, 0x56, 0x56, 0x76, 0x20, 0x3F, 0x7F, 0x6C, 0x6C, 0x60, 0x3C,
+	0x7C, 0x60, 0x60, 0x7C, 0x3C, 0x0C, 0x3C, 0x70, 0x70, 0x3C, 0x0C, 0x3C, 0x7C, 0x30, 0x30, 0x7C,
+	0x3C, 0x44, 0x6C, 0x38, 0x38, 0x6C, 0x44, 0x06, 0x6E, 0x68, 0x68, 0x7E, 0x3E, 0x66, 0x76, 0x7E,
+	0x6E, 0x66, 0x08, 0x3E, 0x77, 0x41, 0x7F, 0x41, 0x77, 0x3E, 0x08, 0x0C, 0x06, 0x0C, 0x18, 0x0C,
+};
+
+static const uint16_t gFontSmallBoldOffset[95] =
+{
+	0, 2, 7, 12, 17, 23, 29, 31, 35, 39, 43, 49, 52, 56, 58, 64,
+	70, 76, 82, 88, 94, 100, 106, 112, 118, 124, 126, 129, 133, 138, 142, 148,
+	154, 160, 166, 172, 178, 184, 190, 196, 202, 208, 214, 220, 226, 232, 238, 244,
+	250, 256, 262, 268, 274, 280, 286, 292, 298, 304, 310, 314, 320, 324, 330, 336,
+	339, 345, 351, 356, 362, 368, 373, 379, 385, 387, 392, 398, 401, 407, 413, 419,
+	425, 431, 436, 442, 447, 453, 459, 465, 471, 477, 482, 486, 487, 491, 496,
+};
+
+const FontAtlas_t gFontSmallBoldAtlas = { gFontSmallBoldColumns, gFontSmallBoldOffset, 496, 3 };
+#endif
+
+#endif
@@ -0,0 +1,122 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "helper/format.h"
+#include "misc.h"
+
+static const uint32_t gPowersOfTen[] = {
+	1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1
+};
+
+// by subtraction, the M0 has no divide instruction
+static uint8_t Digits(char *pDigits, uint32_t Value, uint8_t MinDigits)
+{
+	uint8_t n = 0;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(gPowersOfTen); i++)
+	{
+		const uint32_t Power = gPowersOfTen[i];
+		char           Digit = '0';
+
+		while (Value >= Power)
+		{
+			Value -= Power;
+			Digit++;
+		}
+
+		if (n > 0 || Digit != '0' || ARRAY_SIZE(gPowersOfTen) - i <= MinDigits)
+			pDigits[n++] = Digit;
+	}
+
+	return n;
+}
+
+static char *Pad(char *pBuffer, uint8_t Count, char With)
+{
+	while (Count--)
+		*pBuffer++ = With;
+	return pBuffer;
+}
+
+char *FORMAT_String(char *pBuffer, const char *pString)
+{
+	while (*pString)
+		*pBuffer++ = *pString++;
+	*pBuffer = '\0';
+	return pBuffer;
+}
+
+char *FORMAT_Unsigned(char *pBuffer, uint32_t Value, uint8_t Width, char PadWith)
+{
+	char          Buffer[10];
+	const uint8_t n = Digits(Buffer, Value, 1);
+
+	if (Width > n)
+		pBuffer = Pad(pBuffer, Width - n, PadWith);
+	for (uint8_t i = 0; i < n; i++)
+		*pBuffer++ = Buffer[i];
+	*pBuffer = '\0';
+	return pBuffer;
+}
+
+char *FORMAT_Signed(char *pBuffer, int32_t Value, uint8_t Width, char Plus)
+{
+	char           Buffer[10];
+	const char     Sign = (Value < 0) ? '-' : Plus;
+	const uint8_t  n    = Digits(Buffer, (Value < 0) ? 0U - (uint32_t)Value : (uint32_t)Value, 1);
+	const uint8_t  Size = n + (Sign != '\0');
+
+	if (Width > Size)
+		pBuffer = Pad(pBuffer, Width - Size, ' ');
+	if (Sign != '\0')
+		*pBuffer++ = Sign;
+	for (uint8_t i = 0; i < n; i++)
+		*pBuffer++ = Buffer[i];
+	*pBuffer = '\0';
+	return pBuffer;
+}
+
+char *FORMAT_Frequency(char *pBuffer, uint32_t Frequency, bool bTrim)
+{
+	char          Buffer[10];
+	const uint8_t n = Digits(Buffer, Frequency, 6);
+	uint8_t       Last = n;
+
+	if (bTrim)
+		while (Last > n - 5 && Buffer[Last - 1] == '0')
+			Last--;
+
+	for (uint8_t i = 0; i < Last; i++)
+	{
+		if (i == n - 5)
+			*pBuffer++ = '.';
+		*pBuffer++ = Buffer[i];
+	}
+	*pBuffer = '\0';
+	return pBuffer;
+}
+
+char *FORMAT_SLevel(char *pBuffer, uint8_t SLevel, uint8_t Over)
+{
+	*pBuffer++ = 'S';
+	pBuffer = FORMAT_Unsigned(pBuffer, SLevel, 2, ' ');
+	if (Over > 0)
+	{
+		*pBuffer++ = '+';
+		pBuffer = FORMAT_Unsigned(pBuffer, Over, 2, ' ');
+	}
+	return pBuffer;
+}
@@ -0,0 +1,33 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_FORMAT_H
+#define HELPER_FORMAT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Number formatting for the screens that redraw every frame, without the
+// printf engine. Each function writes at pBuffer, terminates the string and
+// returns a pointer to the terminator so the calls can be chained.
+
+char *FORMAT_String(char *pBuffer, const char *pString);
+char *FORMAT_Unsigned(char *pBuffer, uint32_t Value, uint8_t Width, char PadWith);   // "%*u", "%0*u"
+char *FORMAT_Signed(char *pBuffer, int32_t Value, uint8_t Width, char Plus);         // "%*d", Plus ' ' or '+' for "% *d", "%+*d"
+char *FORMAT_Frequency(char *pBuffer, uint32_t Frequency, bool bTrim);             // 10Hz units, "%u.%05u", trailing zeros cut when bTrim
+char *FORMAT_SLevel(char *pBuffer, uint8_t SLevel, uint8_t Over);                   // "S%2u", "S%2u+%2u" over S9
+
+#endif
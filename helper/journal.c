@@ -0,0 +1,219 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "driver/eeprom.h"
+#include "helper/journal.h"
+#include "misc.h"
+
+// marker record: every home location is up to date, older records are stale
+#define JOURNAL_KEY_SYNC 0x0E
+
+typedef struct {
+	uint8_t Seq;
+	uint8_t Key;    // low nibble: key, high nibble: check
+	uint8_t Data[JOURNAL_PAYLOAD_SIZE];
+} JournalRecord_t;
+
+static const uint8_t gKeySize[JOURNAL_KEY_COUNT] = {
+	[JOURNAL_KEY_SPECTRUM]    = 1,
+	[JOURNAL_KEY_VFO_INDICES] = 6,
+	[JOURNAL_KEY_VFO_A_FREQ]  = 5,
+	[JOURNAL_KEY_VFO_B_FREQ]  = 5,
+};
+
+static uint8_t gCache[JOURNAL_KEY_COUNT][JOURNAL_PAYLOAD_SIZE];
+static uint8_t gCacheValid;   // one bit per key
+static uint8_t gNextSlot;
+static uint8_t gNextSeq;
+static bool    gDirty;        // records appended since the last sync
+
+static uint8_t Check(const JournalRecord_t *pRecord)
+{
+	uint8_t c = pRecord->Seq ^ (pRecord->Key & 0x0F) ^ 0x5A;
+	for (unsigned int i = 0; i < JOURNAL_PAYLOAD_SIZE; i++)
+		c ^= pRecord->Data[i];
+	return (c ^ (c >> 4)) & 0x0F;
+}
+
+// sequence numbers wrap, all live records are within JOURNAL_SLOTS of each other
+static bool IsNewer(uint8_t a, uint8_t b)
+{
+	return (int8_t)(a - b) > 0;
+}
+
+static uint16_t HomeAddress(JOURNAL_Key_t Key, const uint8_t *pData)
+{
+	switch (Key)
+	{
+		case JOURNAL_KEY_SPECTRUM:
+			return 0x1D00;
+		case JOURNAL_KEY_VFO_INDICES:
+			return 0x0E80;
+		default:	// pData[0] is the VFO frequency channel
+			return 0x0C80 + ((pData[0] - FREQ_CHANNEL_FIRST) * 32) + ((Key - JOURNAL_KEY_VFO_A_FREQ) * 16);
+	}
+}
+
+static void WriteHome(JOURNAL_Key_t Key)
+{
+	const uint8_t  *pData   = gCache[Key];
+	const uint16_t  Address = HomeAddress(Key, pData);
+	uint8_t         Block[8];
+
+	EEPROM_ReadBuffer(Address, Block, sizeof(Block));
+	if (Key >= JOURNAL_KEY_VFO_A_FREQ)
+		memcpy(Block, pData + 1, 4);
+	else
+		memcpy(Block, pData, gKeySize[Key]);
+	EEPROM_WriteBuffer(Address, Block, true);
+}
+
+static void Checkpoint(void)
+{
+	for (unsigned int Key = 0; Key < JOURNAL_KEY_COUNT; Key++)
+		if (gCacheValid & (1u << Key))
+			WriteHome(Key);
+}
+
+static void Append(uint8_t Key, const void *pData, uint8_t Size)
+{
+	JournalRecord_t Record;
+
+	// the ring wraps and the oldest records are about to be overwritten,
+	// bring the home locations up to date first
+	if (gNextSlot == 0)
+		Checkpoint();
+
+	Record.Seq = gNextSeq++;
+	Record.Key = Key;
+	memset(Record.Data, 0xFF, sizeof(Record.Data));
+	if (pData != NULL)
+		memcpy(Record.Data, pData, Size);
+	Record.Key |= Check(&Record) << 4;
+
+	EEPROM_WriteBuffer(JOURNAL_ADDR + (gNextSlot * sizeof(Record)), &Record, true);
+
+	gNextSlot = (gNextSlot + 1) % JOURNAL_SLOTS;
+	gDirty    = (Key != JOURNAL_KEY_SYNC);
+}
+
+void JOURNAL_Init(void)
+{
+	JournalRecord_t Ring[JOURNAL_SLOTS];
+	uint8_t         Latest[JOURNAL_KEY_COUNT + 1];   // slot of the newest record per key, last entry is the sync marker
+	uint8_t         Head = 0xFF;
+
+	memset(Latest, 0xFF, sizeof(Latest));
+
+	EEPROM_ReadBuffer(JOURNAL_ADDR, Ring, sizeof(Ring));
+
+	for (unsigned int i = 0; i < JOURNAL_SLOTS; i++)
+	{
+		uint8_t Key = Ring[i].Key & 0x0F;
+
+		if (Key >= JOURNAL_KEY_COUNT && Key != JOURNAL_KEY_SYNC)
+			continue;   // erased or garbage
+		if ((Ring[i].Key >> 4) != Check(&Ring[i]))
+			continue;
+
+		if (Key == JOURNAL_KEY_SYNC)
+			Key = JOURNAL_KEY_COUNT;
+
+		if (Latest[Key] == 0xFF || IsNewer(Ring[i].Seq, Ring[Latest[Key]].Seq))
+			Latest[Key] = i;
+
+		if (Head == 0xFF || IsNewer(Ring[i].Seq, Ring[Head].Seq))
+			Head = i;
+	}
+
+	if (Head == 0xFF) {
+		gNextSlot = 0;
+		gNextSeq  = 0;
+		gDirty    = false;
+	}
+	else {
+		gNextSlot = (Head + 1) % JOURNAL_SLOTS;
+		gNextSeq  = Ring[Head].Seq + 1;
+		gDirty    = (Head != Latest[JOURNAL_KEY_COUNT]);
+	}
+
+	gCacheValid = 0;
+
+	for (unsigned int Key = 0; Key < JOURNAL_KEY_COUNT; Key++)
+	{
+		const uint8_t Slot = Latest[Key];
+		const uint8_t Sync = Latest[JOURNAL_KEY_COUNT];
+
+		if (Slot != 0xFF && (Sync == 0xFF || IsNewer(Ring[Slot].Seq, Ring[Sync].Seq)))
+			memcpy(gCache[Key], Ring[Slot].Data, gKeySize[Key]);
+		else if (Key < JOURNAL_KEY_VFO_A_FREQ)
+			EEPROM_ReadBuffer(HomeAddress(Key, NULL), gCache[Key], gKeySize[Key]);
+		else
+			continue;   // frequency stays in the VFO channel until it is changed
+
+		gCacheValid |= 1u << Key;
+	}
+}
+
+/*
+Latest value of a key
+returns false if the key has no value yet, the home location is then authoritative
+*/
+bool JOURNAL_Read(JOURNAL_Key_t Key, void *pData)
+{
+	if (!(gCacheValid & (1u << Key)))
+		return false;
+
+	memcpy(pData, gCache[Key], gKeySize[Key]);
+	return true;
+}
+
+void JOURNAL_Write(JOURNAL_Key_t Key, const void *pData)
+{
+	const uint8_t *pBytes = (const uint8_t *)pData;
+	const uint8_t  Size   = gKeySize[Key];
+	const uint8_t  Bit    = 1u << Key;
+
+	if (gCacheValid & Bit)
+	{
+		if (memcmp(gCache[Key], pBytes, Size) == 0)
+			return;   // no change, nothing to burn
+
+		// the VFO moved to another band, flush the frequency of the band it leaves
+		if (Key >= JOURNAL_KEY_VFO_A_FREQ && gCache[Key][0] != pBytes[0])
+			WriteHome(Key);
+	}
+
+	memcpy(gCache[Key], pBytes, Size);
+	gCacheValid |= Bit;
+
+	Append(Key, pBytes, Size);
+}
+
+/*
+Brings every home location up to date, used before a PC reads or writes the EEPROM
+*/
+void JOURNAL_Sync(void)
+{
+	if (!gDirty)
+		return;
+
+	Checkpoint();
+	Append(JOURNAL_KEY_SYNC, NULL, 0);
+}
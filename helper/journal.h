@@ -0,0 +1,46 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_JOURNAL_H
+#define HELPER_JOURNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Small log structured area for the EEPROM cells that change all the time.
+// Every save appends one 8 byte record (seq, key, 6 bytes payload) to the
+// next slot of a ring, the home location of a key is only rewritten when
+// the ring wraps or when a PC programming session starts.
+
+#define JOURNAL_ADDR         0x1DC0
+#define JOURNAL_SLOTS        8
+#define JOURNAL_PAYLOAD_SIZE 6
+
+enum JOURNAL_Key_t {
+	JOURNAL_KEY_SPECTRUM = 0,   // spectrum mode to resume (home 0x1D00)
+	JOURNAL_KEY_VFO_INDICES,    // screen/MR/freq channels of both VFOs (home 0x0E80)
+	JOURNAL_KEY_VFO_A_FREQ,     // channel + RX frequency of upper VFO (home 0x0C80 + band * 32)
+	JOURNAL_KEY_VFO_B_FREQ,     // channel + RX frequency of lower VFO (home 0x0C90 + band * 32)
+	JOURNAL_KEY_COUNT
+};
+typedef enum JOURNAL_Key_t JOURNAL_Key_t;
+
+void JOURNAL_Init(void);
+bool JOURNAL_Read(JOURNAL_Key_t Key, void *pData);
+void JOURNAL_Write(JOURNAL_Key_t Key, const void *pData);
+void JOURNAL_Sync(void);
+
+#endif
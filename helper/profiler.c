@@ -0,0 +1,84 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+
+#include "ARMCM0.h"
+#include "helper/profiler.h"
+#include "scheduler.h"
+
+const char * const gProfilerSectionNames[PROFILER_SECTION_COUNT] = {
+	[PROFILER_TIMESLICE_10MS]   = "10MS",
+	[PROFILER_TIMESLICE_500MS]  = "500MS",
+	[PROFILER_UPDATE]           = "UPDATE",
+	[PROFILER_RADIO_INTERRUPTS] = "RADIO IRQ",
+	[PROFILER_DISPLAY]          = "DISPLAY",
+	[PROFILER_UART_COMMAND]     = "UART CMD",
+	[PROFILER_SPECTRUM_INPUT]   = "SP INPUT",
+	[PROFILER_SPECTRUM_SCAN]    = "SP SCAN",
+	[PROFILER_SPECTRUM_RENDER]  = "SP RENDER",
+};
+
+static PROFILER_Stats_t gStats[PROFILER_SECTION_COUNT];
+
+/*
+Core clock cycles since power on, wraps after about 89 seconds
+*/
+uint32_t PROFILER_Now(void)
+{
+	uint32_t Tick;
+	uint32_t Value;
+
+	// the tick and the counter have to come from the same SysTick period
+	do {
+		Tick  = SCHEDULER_GetTick();
+		Value = SysTick->VAL;
+	} while (Tick != SCHEDULER_GetTick());
+
+	return (Tick * (SysTick->LOAD + 1)) + (SysTick->LOAD - Value);
+}
+
+void PROFILER_Record(PROFILER_Section_t Section, uint32_t Start)
+{
+	PROFILER_Stats_t *pStats = &gStats[Section];
+	const uint32_t    Cycles = PROFILER_Now() - Start;
+
+	if (pStats->Count == 0) {
+		pStats->Min = Cycles;
+		pStats->Avg = Cycles;
+	}
+	else
+		pStats->Avg += ((int32_t)(Cycles - pStats->Avg)) / 16;
+
+	if (Cycles < pStats->Min)
+		pStats->Min = Cycles;
+	if (Cycles > pStats->Max)
+		pStats->Max = Cycles;
+	if (Cycles > SysTick->LOAD + 1 && pStats->Overruns < 0xFFFF)
+		pStats->Overruns++;
+
+	pStats->Count++;
+}
+
+void PROFILER_Get(PROFILER_Section_t Section, PROFILER_Stats_t *pStats)
+{
+	*pStats = gStats[Section];
+}
+
+void PROFILER_Reset(void)
+{
+	memset(gStats, 0, sizeof(gStats));
+}
@@ -0,0 +1,67 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HELPER_PROFILER_H
+#define HELPER_PROFILER_H
+
+#include <stdint.h>
+
+// Execution time of instrumented sections, in core clock cycles taken from
+// the SysTick counter. PROFILE() runs the statement alone when the profiler
+// is disabled in the Makefile.
+
+enum PROFILER_Section_t {
+	PROFILER_TIMESLICE_10MS = 0,
+	PROFILER_TIMESLICE_500MS,
+	PROFILER_UPDATE,              // APP_Update()
+	PROFILER_RADIO_INTERRUPTS,    // CheckRadioInterrupts()
+	PROFILER_DISPLAY,             // GUI_DisplayScreen()
+	PROFILER_UART_COMMAND,        // UART_HandleCommand()
+	PROFILER_SPECTRUM_INPUT,      // spectrum Tick() phases
+	PROFILER_SPECTRUM_SCAN,
+	PROFILER_SPECTRUM_RENDER,
+	PROFILER_SECTION_COUNT
+};
+typedef enum PROFILER_Section_t PROFILER_Section_t;
+
+typedef struct {
+	uint32_t Count;
+	uint32_t Min;        // cycles
+	uint32_t Avg;        // cycles, average of about the last 16 runs
+	uint32_t Max;        // cycles
+	uint16_t Overruns;   // runs longer than a 10ms tick, saturates
+	uint8_t  Padding[2];
+} PROFILER_Stats_t;
+
+#ifdef ENABLE_PROFILER
+	#define PROFILE(Section, Statement)                \
+		do {                                          \
+			const uint32_t Start_ = PROFILER_Now();   \
+			Statement;                                \
+			PROFILER_Record(Section, Start_);         \
+		} while (0)
+
+	extern const char * const gProfilerSectionNames[PROFILER_SECTION_COUNT];
+
+	uint32_t PROFILER_Now(void);
+	void     PROFILER_Record(PROFILER_Section_t Section, uint32_t Start);
+	void     PROFILER_Get(PROFILER_Section_t Section, PROFILER_Stats_t *pStats);
+	void     PROFILER_Reset(void);
+#else
+	#define PROFILE(Section, Statement) do { Statement; } while (0)
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Host check of helper/format.c against the printf formats it replaces, as
+// external/printf formats them on the radio, followed by a rough timing of
+// both. Built and run by "make host-test".
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "external/printf/printf.h"
+#include "helper/format.h"
+
+// the firmware's snprintf_ gives the expected text, stdio prints the report
+#undef printf
+#undef sprintf
+#undef snprintf
+#undef vsnprintf
+
+#define BENCH_LOOPS 2000000
+
+static unsigned int gFailures;
+static unsigned int gChecks;
+
+static uint32_t gRandom = 0x12345678;
+
+static uint32_t Random(void)
+{
+	gRandom ^= gRandom << 13;
+	gRandom ^= gRandom >> 17;
+	gRandom ^= gRandom << 5;
+	return gRandom;
+}
+
+// small numbers, powers of ten around their edges and the type limits come
+// up far more than a plain random spread would give them
+static uint32_t TestValue(unsigned int i)
+{
+	static const uint32_t Edges[] = {
+		0, 1, 9, 10, 11, 99, 100, 101, 999, 1000, 9999, 10000, 99999, 100000,
+		100001, 999999, 1000000, 9999999, 10000000, 99999999, 100000000,
+		999999999, 1000000000, 2147483647, 2147483648u, 4294967295u
+	};
+
+	if (i < sizeof(Edges) / sizeof(Edges[0]))
+		return Edges[i];
+
+	switch (Random() & 3)
+	{
+		case 0:  return Random() & 0xFF;
+		case 1:  return Random() & 0xFFFF;
+		case 2:  return Random() % 130000000;   // 10Hz units up to 1.3GHz
+		default: return Random();
+	}
+}
+
+static void Check(const char *pWhat, const char *pExpected, const char *pGot, const char *pEnd)
+{
+	gChecks++;
+	if (strcmp(pExpected, pGot) == 0 && pEnd == pGot + strlen(pGot))
+		return;
+
+	if (gFailures++ < 20)
+		printf("FAIL %s: expected \"%s\", got \"%s\"%s\n", pWhat, pExpected, pGot,
+			(pEnd == pGot + strlen(pGot)) ? "" : " (bad end pointer)");
+}
+
+static void RemoveTrailZeros(char *pString)
+{
+	char *p = pString + strlen(pString) - 1;
+
+	while (p > pString && *p == '0')
+		*p-- = '\0';
+	if (*p == '.')
+		*p = '\0';
+}
+
+static void TestValues(unsigned int Count)
+{
+	char Expected[48];
+	char Got[48];
+	char What[48];
+	char *pEnd;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const uint32_t Value  = TestValue(i);
+		const int32_t  Signed = (int32_t)Value;
+
+		for (unsigned int Width = 0; Width <= 12; Width += (Width < 4) ? 1 : 4)
+		{
+			snprintf_(Expected, sizeof(Expected), "%*" PRIu32, (int)Width, Value);
+			pEnd = FORMAT_Unsigned(Got, Value, Width, ' ');
+			snprintf(What, sizeof(What), "%%%uu", Width);
+			Check(What, Expected, Got, pEnd);
+
+			snprintf_(Expected, sizeof(Expected), "%0*" PRIu32, (int)Width, Value);
+			pEnd = FORMAT_Unsigned(Got, Value, Width, '0');
+			snprintf(What, sizeof(What), "%%0%uu", Width);
+			Check(What, Expected, Got, pEnd);
+
+			snprintf_(Expected, sizeof(Expected), "%*" PRId32, (int)Width, Signed);
+			pEnd = FORMAT_Signed(Got, Signed, Width, '\0');
+			snprintf(What, sizeof(What), "%%%ud", Width);
+			Check(What, Expected, Got, pEnd);
+
+			snprintf_(Expected, sizeof(Expected), "% *" PRId32, (int)Width, Signed);
+			pEnd = FORMAT_Signed(Got, Signed, Width, ' ');
+			snprintf(What, sizeof(What), "%% %ud", Width);
+			Check(What, Expected, Got, pEnd);
+
+			snprintf_(Expected, sizeof(Expected), "%+*" PRId32, (int)Width, Signed);
+			pEnd = FORMAT_Signed(Got, Signed, Width, '+');
+			snprintf(What, sizeof(What), "%%+%ud", Width);
+			Check(What, Expected, Got, pEnd);
+		}
+
+		snprintf_(Expected, sizeof(Expected), "%" PRIu32 ".%05" PRIu32, Value / 100000, Value % 100000);
+		pEnd = FORMAT_Frequency(Got, Value, false);
+		Check("frequency", Expected, Got, pEnd);
+
+		RemoveTrailZeros(Expected);
+		pEnd = FORMAT_Frequency(Got, Value, true);
+		Check("trimmed frequency", Expected, Got, pEnd);
+	}
+}
+
+static void TestStrings(void)
+{
+	char  Got[48];
+	char *pEnd;
+
+	pEnd = FORMAT_String(Got, "");
+	Check("empty string", "", Got, pEnd);
+
+	pEnd = FORMAT_String(FORMAT_String(Got, "NFM"), " 12.5k");
+	Check("chained strings", "NFM 12.5k", Got, pEnd);
+
+	for (unsigned int SLevel = 0; SLevel <= 9; SLevel++)
+	{
+		for (unsigned int Over = 0; Over <= 60; Over += 10)
+		{
+			char Expected[16];
+
+			if (Over > 0)
+				snprintf_(Expected, sizeof(Expected), "S%2u+%2u", SLevel, Over);
+			else
+				snprintf_(Expected, sizeof(Expected), "S%2u", SLevel);
+			pEnd = FORMAT_SLevel(Got, SLevel, Over);
+			Check("s-level", Expected, Got, pEnd);
+		}
+	}
+}
+
+// printf_ is not used, external/printf still needs its output
+void _putchar(char c)
+{
+	putchar(c);
+}
+
+static double Seconds(clock_t Start)
+{
+	return (double)(clock() - Start) / CLOCKS_PER_SEC;
+}
+
+// the host CPU says little about the M0, the ratio is what to look at
+static void Benchmark(void)
+{
+	char              Buffer[32];
+	volatile unsigned Sink = 0;
+	clock_t           Start;
+	double            Printf;
+	double            Format;
+
+	Start = clock();
+	for (uint32_t f = 0; f < BENCH_LOOPS; f++)
+	{
+		const uint32_t Value = 14400000 + f * 125;
+		Sink += snprintf_(Buffer, sizeof(Buffer), "%" PRIu32 ".%05" PRIu32, Value / 100000, Value % 100000);
+	}
+	Printf = Seconds(Start);
+
+	Start = clock();
+	for (uint32_t f = 0; f < BENCH_LOOPS; f++)
+		Sink += FORMAT_Frequency(Buffer, 14400000 + f * 125, false) - Buffer;
+	Format = Seconds(Start);
+
+	printf("frequency: snprintf_ %.0f ns, FORMAT_Frequency %.0f ns per call\n",
+		Printf * 1e9 / BENCH_LOOPS, Format * 1e9 / BENCH_LOOPS);
+
+	Start = clock();
+	for (uint32_t i = 0; i < BENCH_LOOPS; i++)
+		Sink += snprintf_(Buffer, sizeof(Buffer), "%3" PRIu32, i & 0xFF);
+	Printf = Seconds(Start);
+
+	Start = clock();
+	for (uint32_t i = 0; i < BENCH_LOOPS; i++)
+		Sink += FORMAT_Unsigned(Buffer, i & 0xFF, 3, ' ') - Buffer;
+	Format = Seconds(Start);
+
+	printf("unsigned:  snprintf_ %.0f ns, FORMAT_Unsigned %.0f ns per call\n",
+		Printf * 1e9 / BENCH_LOOPS, Format * 1e9 / BENCH_LOOPS);
+
+	(void)Sink;
+}
+
+int main(int argc, char *argv[])
+{
+	const int bBenchmark = !(argc > 1 && strcmp(argv[1], "--no-bench") == 0);
+
+	TestValues(200000);
+	TestStrings();
+
+	printf("%u checks, %u failures\n", gChecks, gFailures);
+	if (gFailures)
+		return 1;
+
+	if (bBenchmark)
+		Benchmark();
+
+	return 0;
+}
@@ -0,0 +1,194 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Host replacements for the drivers and the parts of the application that
+// are not built by "make host-ui". The radio reads back zeros, the EEPROM is
+// erased memory and the LCD is a plain copy of what was blitted to it.
+
+#include <string.h>
+
+#include "app/action.h"
+#include "app/chFrScanner.h"
+#include "app/dtmf.h"
+#include "app/scanner.h"
+#include "app/uart.h"
+#include "audio.h"
+#include "board.h"
+#include "driver/backlight.h"
+#include "driver/bk4819.h"
+#include "driver/eeprom.h"
+#include "driver/keyboard.h"
+#include "driver/st7565.h"
+#include "driver/system.h"
+#include "driver/systick.h"
+#include "driver/uart.h"
+#include "functions.h"
+#include "helper/journal.h"
+#include "host/ui_stubs.h"
+#include "scheduler.h"
+#include "ui/ui.h"
+
+uint8_t gHostLcd[8][LCD_WIDTH];
+uint8_t gHostEeprom[0x2000];
+
+// LCD
+
+uint8_t  gStatusLine[128];
+uint8_t  gFrameBuffer[7][128];
+uint16_t gBlitByteCount;
+
+void ST7565_DrawLine(const unsigned int Column, const unsigned int Line, const unsigned int Size, const uint8_t *pBitmap)
+{
+	if (Line >= 8 || Column >= LCD_WIDTH)
+		return;
+	for (unsigned int i = 0; i < Size && Column + i < LCD_WIDTH; i++)
+		gHostLcd[Line][Column + i] = pBitmap ? pBitmap[i] : 0;
+}
+
+void ST7565_BlitStatusLine(void)
+{
+	memcpy(gHostLcd[0], gStatusLine, sizeof(gStatusLine));
+}
+
+void ST7565_BlitFullScreen(void)
+{
+	memcpy(gHostLcd[1], gFrameBuffer, sizeof(gFrameBuffer));
+	gBlitByteCount = sizeof(gFrameBuffer);
+}
+
+void ST7565_BlitDirty(void)
+{
+	ST7565_BlitFullScreen();
+}
+
+void ST7565_InvalidateScreen(void) {}
+void ST7565_Poll(void) {}
+bool ST7565_IsBusy(void) { return false; }
+void ST7565_FillScreen(uint8_t Value) { memset(gHostLcd, Value, sizeof(gHostLcd)); }
+void ST7565_HardwareReset(void) {}
+
+// EEPROM
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	memcpy(pBuffer, gHostEeprom + (Address % sizeof(gHostEeprom)), Size);
+}
+
+void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer, const bool safe)
+{
+	(void)safe;
+	if (pBuffer == NULL)
+		return;
+	memcpy(gHostEeprom + (Address % sizeof(gHostEeprom)), pBuffer, 8);
+}
+
+bool JOURNAL_Read(JOURNAL_Key_t Key, void *pData) { (void)Key; (void)pData; return false; }
+void JOURNAL_Write(JOURNAL_Key_t Key, const void *pData) { (void)Key; (void)pData; }
+
+// BK4819, a receiver that hears nothing
+
+uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register) { (void)Register; return 0; }
+void     BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data) { (void)Register; (void)Data; }
+void     BK4819_SetRegValue(RegisterSpec s, uint16_t v) { (void)s; (void)v; }
+void     BK4819_SetAGC(bool enable) { (void)enable; }
+void     BK4819_InitAGC(const uint8_t agcType, ModulationMode_t modulation) { (void)agcType; (void)modulation; }
+void     BK4819_ToggleGpioOut(BK4819_GPIO_PIN_t Pin, bool bSet) { (void)Pin; (void)bSet; }
+void     BK4819_SetCDCSSCodeWord(uint32_t CodeWord) { (void)CodeWord; }
+void     BK4819_SetCTCSSFrequency(uint32_t BaudRate) { (void)BaudRate; }
+void     BK4819_SetTailDetection(const uint32_t freq_10Hz) { (void)freq_10Hz; }
+void     BK4819_SetFilterBandwidth(const BK4819_FilterBandwidth_t Bandwidth, const bool dynamic) { (void)Bandwidth; (void)dynamic; }
+void     BK4819_SetupPowerAmplifier(const uint8_t bias, const uint32_t frequency) { (void)bias; (void)frequency; }
+void     BK4819_SetFrequency(uint32_t Frequency) { (void)Frequency; }
+void     BK4819_SetupSquelch(uint8_t a, uint8_t b, uint8_t c, uint8_t d, uint8_t e, uint8_t f) { (void)a; (void)b; (void)c; (void)d; (void)e; (void)f; }
+void     BK4819_SetAF(BK4819_AF_Type_t AF) { (void)AF; }
+void     BK4819_PickRXFilterPathBasedOnFrequency(uint32_t Frequency) { (void)Frequency; }
+void     BK4819_DisableScramble(void) {}
+void     BK4819_EnableScramble(uint8_t Type) { (void)Type; }
+void     BK4819_SetCompander(const unsigned int mode) { (void)mode; }
+void     BK4819_DisableVox(void) {}
+void     BK4819_DisableDTMF(void) {}
+void     BK4819_EnableDTMF(void) {}
+void     BK4819_PlaySingleTone(const unsigned int tone_Hz, const unsigned int delay, const unsigned int level, const bool play_speaker) { (void)tone_Hz; (void)delay; (void)level; (void)play_speaker; }
+void     BK4819_PrepareTransmit(bool muteMic) { (void)muteMic; }
+void     BK4819_ExitSubAu(void) {}
+void     BK4819_EnterDTMF_TX(bool bLocalLoopback) { (void)bLocalLoopback; }
+void     BK4819_ExitDTMF_TX(bool bKeep) { (void)bKeep; }
+void     BK4819_PlayDTMFString(const char *pString, bool bDelayFirst, uint16_t a, uint16_t b, uint16_t c, uint16_t d) { (void)pString; (void)bDelayFirst; (void)a; (void)b; (void)c; (void)d; }
+void     BK4819_EnableCDCSS(void) {}
+void     BK4819_EnableCTCSS(void) {}
+uint16_t BK4819_GetRSSI(void) { return 0; }
+uint8_t  BK4819_GetGlitchIndicator(void) { return 0; }
+uint16_t BK4819_GetVoiceAmplitudeOut(void) { return 0; }
+void     BK4819_PlayRoger(void) {}
+void     BK4819_PlayRogerMDC(void) {}
+
+BK4819_CssScanResult_t BK4819_GetCxCSSScanResult(uint32_t *pCdcssFreq, uint16_t *pCtcssFreq)
+{
+	(void)pCdcssFreq;
+	(void)pCtcssFreq;
+	return BK4819_CSS_RESULT_NOT_FOUND;
+}
+
+// board, timing and the rest of the firmware
+
+uint16_t gBacklightCountdown;
+
+void BACKLIGHT_TurnOn(void) {}
+void BACKLIGHT_TurnOff(void) {}
+void BACKLIGHT_SetBrightness(uint8_t brigtness) { (void)brigtness; }
+
+void     BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage) { *pVoltage = 2000; }   // 7.2V with the calibration of ui_test.c
+uint32_t BOARD_fetchChannelFrequency(const int channel) { (void)channel; return 0; }
+void     BOARD_gMR_LoadChannels(void) {}
+int      BOARD_gMR_fetchChannel(const uint32_t freq) { (void)freq; return -1; }
+
+void     SYSTEM_DelayMs(uint32_t Delay) { (void)Delay; }
+void     SYSTICK_DelayUs(uint32_t Delay) { (void)Delay; }
+uint32_t SCHEDULER_GetTick(void) { return 0; }
+void     SCHEDULER_WaitForTick(void) {}
+
+KEY_Code_t KEYBOARD_Poll(void) { return KEY_INVALID; }
+bool       gWasFKeyPressed;
+
+UART_Telemetry_t UART_GetTelemetry(void) { return UART_TELEMETRY_OFF; }
+bool UART_IsBusy(void) { return false; }
+bool UART_IsTxIdle(void) { return true; }
+void UART_Service(void) {}
+bool UART_TrySendFrame(void *pFrame, uint16_t Size) { (void)pFrame; (void)Size; return false; }
+void _putchar(char c) { (void)c; }
+
+FUNCTION_Type_t gCurrentFunction;
+void FUNCTION_Init(void) {}
+void FUNCTION_Select(FUNCTION_Type_t Function) { gCurrentFunction = Function; }
+
+void AUDIO_PlayBeep(BEEP_Type_t Beep) { (void)Beep; }
+
+BK4819_FilterBandwidth_t ACTION_NextBandwidth(BK4819_FilterBandwidth_t currentBandwidth, const bool dynamic)
+{
+	(void)dynamic;
+	return currentBandwidth;
+}
+
+bool   SCANNER_IsScanning(void) { return false; }
+int8_t gScanStateDir;
+uint32_t gScanRangeStart;
+uint32_t gScanRangeStop;
+
+char gDTMF_InputBox[15];
+bool gDTMF_InputMode;
+
+GUI_DisplayType_t gScreenToDisplay;
+uint8_t           gAskForConfirmation;
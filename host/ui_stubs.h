@@ -0,0 +1,28 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_UI_STUBS_H
+#define HOST_UI_STUBS_H
+
+#include <stdint.h>
+
+#include "driver/st7565.h"
+
+// what the LCD shows, page 0 is the status line
+extern uint8_t gHostLcd[8][LCD_WIDTH];
+extern uint8_t gHostEeprom[0x2000];
+
+#endif
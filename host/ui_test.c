@@ -0,0 +1,177 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Renders a fixed set of screens on the host and prints them in the format of
+// screenshot.h, "make host-ui" cuts them with screenshot.py and compares them
+// with host/golden. The spectrum is included whole to reach its renderer.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "app/spectrum.c"
+
+#include "helper/battery.h"
+#include "host/ui_stubs.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+#include "ui/main.h"
+#include "ui/menu.h"
+#include "ui/status.h"
+
+// same layout as getScreenShot()
+static void Dump(void)
+{
+	char Row[LCD_WIDTH + 2];
+
+	fputs("P1\n128 64\n", stdout);
+	for (unsigned int Page = 0; Page < 8; Page++)
+	{
+		for (unsigned int b = 0; b < 8; b++)
+		{
+			for (unsigned int i = 0; i < LCD_WIDTH; i++)
+				Row[i] = ((gHostLcd[Page][i] >> b) & 0x01) ? '1' : '0';
+			Row[LCD_WIDTH]     = '\n';
+			Row[LCD_WIDTH + 1] = '\0';
+			fputs(Row, stdout);
+		}
+	}
+	fputs("----------------\n", stdout);
+}
+
+static void InitRadio(void)
+{
+	memset(gHostEeprom, 0xFF, sizeof(gHostEeprom));
+	memset(gMR_ChannelAttributes, 0xFF, sizeof(gMR_ChannelAttributes));
+	memset(&gEeprom, 0, sizeof(gEeprom));
+
+	gEeprom.DUAL_WATCH           = DUAL_WATCH_OFF;
+	gEeprom.TX_VFO               = 0;
+	gEeprom.SQUELCH_LEVEL        = 3;
+	gEeprom.ScreenChannel[0]     = FREQ_CHANNEL_FIRST + BAND3_137MHz;
+	gEeprom.ScreenChannel[1]     = FREQ_CHANNEL_FIRST + BAND6_400MHz;
+	gEeprom.FreqChannel[0]       = gEeprom.ScreenChannel[0];
+	gEeprom.FreqChannel[1]       = gEeprom.ScreenChannel[1];
+
+	RADIO_InitInfo(&gEeprom.VfoInfo[0], gEeprom.ScreenChannel[0], 14550000);
+	RADIO_InitInfo(&gEeprom.VfoInfo[1], gEeprom.ScreenChannel[1], 43312500);
+	RADIO_SelectVfos();
+
+	// as Main() does, without the hidden items
+	gMenuListCount = 0;
+	while (MenuList[gMenuListCount].name[0] != '\0' && MenuList[gMenuListCount].menu_id != FIRST_HIDDEN_MENU_ITEM)
+		gMenuListCount++;
+
+	{
+		static const uint16_t Calibration[] = {1900, 2000, 2050, 2100, 2150, 2300};
+		memcpy(gBatteryCalibration, Calibration, sizeof(Calibration));
+	}
+	gBatteryDisplayLevel = 5;
+	gCurrentFunction     = FUNCTION_FOREGROUND;
+}
+
+static void MainScreen(void)
+{
+	gScreenToDisplay = DISPLAY_MAIN;
+	UI_DisplayStatus();
+	UI_DisplayMain();
+	Dump();
+}
+
+static void MenuScreen(uint8_t MenuId, int32_t Selection, bool bInSubMenu)
+{
+	uint8_t Cursor = 0;
+
+	while (Cursor < gMenuListCount - 1 && MenuList[Cursor].menu_id != MenuId)
+		Cursor++;
+
+	gScreenToDisplay  = DISPLAY_MENU;
+	gMenuCursor       = Cursor;
+	gSubMenuSelection = Selection;
+	gIsInSubMenu      = bInSubMenu;
+	UI_DisplayStatus();
+	UI_DisplayMenu();
+	Dump();
+}
+
+// a sweep over 128 bins with two carriers, the same every run
+static void FillSpectrum(void)
+{
+	for (unsigned int i = 0; i < ARRAY_SIZE(rssiHistory); i++)
+	{
+		uint16_t Rssi = 70 + (i * 7) % 11;
+
+		if (i >= 40 && i <= 44)
+			Rssi = 150 - 10 * (i > 42 ? i - 42 : 42 - i);
+		if (i >= 90 && i <= 92)
+			Rssi = 120 - 15 * (i > 91 ? i - 91 : 91 - i);
+		rssiHistory[i] = Rssi;
+	}
+}
+
+static void SpectrumScreens(void)
+{
+	static const uint32_t Heard[] = {14550000, 14562500, 43312500, 44600625};
+
+	appMode     = FREQUENCY_MODE;
+	currentFreq = initialFreq = 14400000;
+	isListening = false;   // ToggleRX() reaches the audio GPIOs, stay off it
+	ResetPeak();
+	InitScan();
+	SetState(SPECTRUM);
+
+	FillSpectrum();
+	peak.f    = GetFStart() + 42 * GetScanStep();
+	peak.rssi = 150;
+	peak.i    = 42;
+	scanInfo.rssiMin = 70;
+	scanInfo.rssiMax = 150;
+	RenderStatus();
+	Render();
+	Dump();
+
+	SetState(STILL);
+	SetF(peak.f);
+	scanInfo.rssi = 130;
+	RenderStatus();
+	Render();
+	Dump();
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(Heard); i++)
+	{
+		scanInfo.f = Heard[i];
+		FillfreqHistory(true);
+		wasReceiving = false;
+	}
+	SetState(HISTORY_LIST);
+	historyListIndex = 1;
+	RenderStatus();
+	Render();
+	Dump();
+}
+
+// frames: 0 main, 1-2 menu, 3 spectrum, 4 still, 5 history list
+int main(void)
+{
+	InitRadio();
+
+	MainScreen();
+	MenuScreen(MENU_SQL, 3, false);
+	MenuScreen(MENU_STEP, STEP_12_5kHz, true);
+	SpectrumScreens();
+
+	return 0;
+}
@@ -22,6 +22,7 @@
 
 #include "app/app.h"
 #include "app/dtmf.h"
+#include "app/uart.h"
 #include "audio.h"
 #include "bsp/dp32g030/gpio.h"
 #include "bsp/dp32g030/syscon.h"
@@ -29,13 +30,18 @@
 #include "driver/backlight.h"
 #include "driver/bk4819.h"
 #include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "driver/st7565.h"
 #include "driver/system.h"
 #include "driver/systick.h"
 #include "driver/uart.h"
 #include "helper/battery.h"
 #include "helper/boot.h"
+#include "helper/journal.h"
+#include "helper/profiler.h"
 #include "misc.h"
 #include "radio.h"
+#include "scheduler.h"
 #include "settings.h"
 #include "ui/lock.h"
 #include "ui/welcome.h"
@@ -50,6 +56,25 @@ void _putchar(char c)
 	UART_Send((uint8_t *)&c, 1);
 }
 
+static SCHEDULER_Task_t gTimeslice10msTask;
+static SCHEDULER_Task_t gUpdateTask;
+static SCHEDULER_Task_t gTimeslice500msTask;
+
+static void Timeslice10ms(void)
+{
+	PROFILE(PROFILER_TIMESLICE_10MS, APP_TimeSlice10ms());
+}
+
+static void Update(void)
+{
+	PROFILE(PROFILER_UPDATE, APP_Update());
+}
+
+static void Timeslice500ms(void)
+{
+	PROFILE(PROFILER_TIMESLICE_500MS, APP_TimeSlice500ms());
+}
+
 void Main(void)
 {
 	unsigned int i;
@@ -68,6 +93,7 @@ void Main(void)
 		| SYSCON_DEV_CLK_GATE_PWM_PLUS0_BITS_ENABLE;
 
 	SYSTICK_Init();
+	I2C_Calibrate();
 	BOARD_Init();
 	UART_Init();
 
@@ -84,6 +110,8 @@ void Main(void)
 
 	BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage);
 
+	JOURNAL_Init();
+
 	BOARD_EEPROM_Init();
 
 	BK4819_Init();
@@ -216,20 +244,21 @@ void Main(void)
 		// ******************
 	}
 
+	// the radio interrupts are read in the 10ms slice, the update acts on them right after
+	SCHEDULER_Start(&gTimeslice10msTask, Timeslice10ms, 1, 1);
+	SCHEDULER_Start(&gUpdateTask, Update, 1, 1);
+	SCHEDULER_Start(&gTimeslice500msTask, Timeslice500ms, 50, 50);
+
 	while (1)
 	{
-		APP_Update();
+		UART_Poll();
+		UART_RunJob();
+		ST7565_Poll();
 
-		if (gNextTimeslice)
-		{
-			APP_TimeSlice10ms();
-			gNextTimeslice = false;
-		}
+		SCHEDULER_Run();
 
-		if (gNextTimeslice_500ms)
-		{
-			APP_TimeSlice500ms();
-			gNextTimeslice_500ms = false;
-		}
+		// UART and LCD transfers are moved along by polling, they keep the core awake
+		if (!UART_IsBusy() && UART_IsTxIdle() && !ST7565_IsBusy())
+			SCHEDULER_Idle();
 	}
 }
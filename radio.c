@@ -33,6 +33,7 @@
 #include "frequencies.h"
 #include "functions.h"
 #include "helper/battery.h"
+#include "helper/journal.h"
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
@@ -315,6 +316,12 @@ void RADIO_ConfigureChannel(const unsigned int VFO, const unsigned int configure
 			uint32_t Offset;
 		} __attribute__((packed)) info;
 		EEPROM_ReadBuffer(base, &info, sizeof(info));
+		if (!IS_MR_CHANNEL(channel))
+		{	// the last tuned frequency may still be in the journal
+			uint8_t Last[5];
+			if (JOURNAL_Read(JOURNAL_KEY_VFO_A_FREQ + VFO, Last) && Last[0] == channel)
+				memcpy(&info.Frequency, &Last[1], 4);
+		}
 		if(info.Frequency==0xFFFFFFFF)
 			pVfo->freq_config_RX.Frequency = frequencyBandTable[band].lower;
 		else
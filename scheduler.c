@@ -17,6 +17,9 @@
  *     limitations under the License.
  */
 
+#include <stddef.h>
+
+#include "ARMCM0.h"
 #include "app/chFrScanner.h"
 #ifdef ENABLE_FMRADIO
 	#include "app/fm.h"
@@ -26,9 +29,11 @@
 #include "functions.h"
 #include "helper/battery.h"
 #include "misc.h"
+#include "scheduler.h"
 #include "settings.h"
 
 #include "driver/backlight.h"
+#include "driver/systick.h"
 #include "bsp/dp32g030/gpio.h"
 #include "driver/gpio.h"
 
@@ -46,9 +51,158 @@
 	} while (0)
 
 static volatile uint32_t gGlobalSysTickCounter;
+static SCHEDULER_Task_t *gTaskQueue;   // sorted by due tick
+static uint32_t          gSleepCycles; // core clock cycles spent in WFI, wraps
 
 void SystickHandler(void);
 
+// 10ms ticks since power on
+uint32_t SCHEDULER_GetTick(void)
+{
+	return gGlobalSysTickCounter;
+}
+
+// the tick counter wraps, due ticks are compared relative to now
+static bool IsDue(const SCHEDULER_Task_t *pTask, uint32_t Now)
+{
+	return (int32_t)(Now - pTask->Due) >= 0;
+}
+
+static void Insert(SCHEDULER_Task_t *pTask)
+{
+	SCHEDULER_Task_t **ppLink = &gTaskQueue;
+
+	while (*ppLink != NULL && (int32_t)((*ppLink)->Due - pTask->Due) <= 0)
+		ppLink = &(*ppLink)->pNext;
+
+	pTask->pNext   = *ppLink;
+	pTask->bActive = true;
+	*ppLink        = pTask;
+}
+
+void SCHEDULER_Start(SCHEDULER_Task_t *pTask, SCHEDULER_Callback_t Callback, uint16_t Delay_10ms, uint16_t Period_10ms)
+{
+	SCHEDULER_Stop(pTask);
+
+	pTask->Callback = Callback;
+	pTask->Due      = gGlobalSysTickCounter + Delay_10ms;
+	pTask->Period   = Period_10ms;
+
+	Insert(pTask);
+}
+
+void SCHEDULER_Stop(SCHEDULER_Task_t *pTask)
+{
+	SCHEDULER_Task_t **ppLink = &gTaskQueue;
+
+	if (!pTask->bActive)
+		return;
+
+	while (*ppLink != NULL && *ppLink != pTask)
+		ppLink = &(*ppLink)->pNext;
+
+	if (*ppLink != NULL)
+		*ppLink = pTask->pNext;
+
+	pTask->bActive = false;
+}
+
+bool SCHEDULER_IsDue(void)
+{
+	return gTaskQueue != NULL && IsDue(gTaskQueue, gGlobalSysTickCounter);
+}
+
+// called with interrupts masked, a pending interrupt still ends the WFI
+static void Sleep(void)
+{
+	const uint32_t Start = SYSTICK_GetValue();
+
+	__WFI();
+
+	gSleepCycles += SYSTICK_CyclesSince(Start);
+}
+
+/*
+Stops the core until the next interrupt, unless a task is already due
+*/
+void SCHEDULER_Idle(void)
+{
+	__disable_irq();
+
+	if (!SCHEDULER_IsDue())
+		Sleep();
+
+	__enable_irq();
+}
+
+/*
+Stops the core until the next SysTick, for loops that run outside the main loop
+*/
+void SCHEDULER_WaitForTick(void)
+{
+	const uint32_t Tick = gGlobalSysTickCounter;
+
+	__disable_irq();
+
+	while (gGlobalSysTickCounter == Tick)
+	{
+		Sleep();
+
+		// let the handler run, it is what moves the counter
+		__enable_irq();
+		__disable_irq();
+	}
+
+	__enable_irq();
+}
+
+/*
+Core clock cycles asleep and awake since power on, both wrap, use differences over less
+than a minute
+*/
+void SCHEDULER_GetCycles(uint32_t *pSleep, uint32_t *pActive)
+{
+	uint32_t Tick;
+	uint32_t Value;
+	uint32_t Asleep;
+
+	do {
+		Tick   = gGlobalSysTickCounter;
+		Value  = SYSTICK_GetValue();
+		Asleep = gSleepCycles;
+	} while (Tick != gGlobalSysTickCounter);
+
+	*pSleep  = Asleep;
+	*pActive = (Tick * (SysTick->LOAD + 1)) + (SysTick->LOAD - Value) - Asleep;
+}
+
+/*
+Runs every task due now, a periodic task runs once per call even when it is late,
+runs it missed while the main loop was held up are dropped
+*/
+void SCHEDULER_Run(void)
+{
+	const uint32_t Now = gGlobalSysTickCounter;
+
+	while (gTaskQueue != NULL && IsDue(gTaskQueue, Now))
+	{
+		SCHEDULER_Task_t *pTask = gTaskQueue;
+
+		gTaskQueue     = pTask->pNext;
+		pTask->bActive = false;
+
+		if (pTask->Period > 0)
+		{
+			pTask->Due += pTask->Period;
+			if (IsDue(pTask, Now))
+				pTask->Due = Now + pTask->Period;
+			Insert(pTask);
+		}
+
+		pTask->Callback();
+	}
+}
+
 // we come here every 10ms
 void SystickHandler(void)
 {
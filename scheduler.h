@@ -0,0 +1,47 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tasks run from the main loop, in order of their due tick, tasks due on the
+// same tick in the order they were started. The SysTick handler only counts
+// ticks, a task costs nothing until it is due. Tasks are started and stopped
+// from the main loop only, never from an interrupt.
+
+typedef void (*SCHEDULER_Callback_t)(void);
+
+typedef struct SCHEDULER_Task_t {
+	struct SCHEDULER_Task_t *pNext;
+	SCHEDULER_Callback_t     Callback;
+	uint32_t                 Due;       // tick of the next run
+	uint16_t                 Period;    // 10ms ticks, 0: one-shot
+	bool                     bActive;
+} SCHEDULER_Task_t;
+
+uint32_t SCHEDULER_GetTick(void);
+void     SCHEDULER_Start(SCHEDULER_Task_t *pTask, SCHEDULER_Callback_t Callback, uint16_t Delay_10ms, uint16_t Period_10ms);
+void     SCHEDULER_Stop(SCHEDULER_Task_t *pTask);
+bool     SCHEDULER_IsDue(void);
+void     SCHEDULER_Run(void);
+void     SCHEDULER_Idle(void);
+void     SCHEDULER_WaitForTick(void);
+void     SCHEDULER_GetCycles(uint32_t *pSleep, uint32_t *pActive);
+
+#endif
@@ -17,35 +17,28 @@
 #include "debugging.h"
 #include "driver/st7565.h"
 
+// Dumps the status line and the frame buffer as a plain PBM image (P1, 1 = lit pixel),
+// one text line per pixel row, so a UART capture can be cut into .pbm files with
+// screenshot.py and compared against reference images.
 static inline void getScreenShot(void)
 {
-    char str[2] = "";
+    char row[LCD_WIDTH + 2];
 
-    //LogUart("P1\n");
-    //LogUart("128 64\n");
+    LogUart("P1\n128 64\n");
 
-    for(uint8_t b = 0; b < 8; b++)
+    for(uint8_t page = 0; page < 8; page++)
     {
-        for(uint8_t i = 0; i < 128; i++)
-        {
-            sprintf(str, "%d,", !((gStatusLine[i] >> b)  & 0x01));
-            LogUart(str);
-        }
-        //LogUart("\n");
-    }
+        const uint8_t *line = (page == 0) ? gStatusLine : gFrameBuffer[page - 1];
 
-    for(uint8_t l = 0; l < 7; l++)
-    {
         for(uint8_t b = 0; b < 8; b++)
         {
-            for(uint8_t i = 0; i < 128; i++)
-            {
-                sprintf(str, "%d,", !((gFrameBuffer[l][i] >> b)  & 0x01));
-                LogUart(str);
-            }
+            for(uint8_t i = 0; i < LCD_WIDTH; i++)
+                row[i] = ((line[i] >> b) & 0x01) ? '1' : '0';
+            row[LCD_WIDTH]     = '\n';
+            row[LCD_WIDTH + 1] = '\0';
+            LogUart(row);
         }
-        //LogUart("\n");
     }
 
-    LogUart("\n----------------\n");
-}
\ No newline at end of file
+    LogUart("----------------\n");
+}
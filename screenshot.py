@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+# Cuts the screenshots of a UART capture (firmware built with ENABLE_SCREENSHOT)
+# into .pbm files and optionally compares them with reference images.
+#
+#   screenshot.py capture.txt out_dir [reference_dir]
+#
+# Frame n is written to out_dir/n.pbm. With a reference directory every frame is
+# compared with reference_dir/n.pbm, the differing pixels are counted and the exit
+# status is 1 if any frame differs.
+
+import os
+import sys
+
+WIDTH  = 128
+HEIGHT = 64
+
+def frames(text):
+    lines = [l.strip() for l in text.splitlines()]
+    for i, l in enumerate(lines):
+        if l == 'P1' and i + 1 < len(lines) and lines[i + 1] == '%u %u' % (WIDTH, HEIGHT):
+            rows = lines[i + 2:i + 2 + HEIGHT]
+            if len(rows) == HEIGHT and all(len(r) == WIDTH for r in rows):
+                yield rows
+
+def read_pbm(path):
+    tokens = open(path).read().split()
+    if tokens[0] != 'P1' or tokens[1:3] != [str(WIDTH), str(HEIGHT)]:
+        raise ValueError(path + ': not a %ux%u plain PBM' % (WIDTH, HEIGHT))
+    bits = ''.join(tokens[3:])
+    return [bits[y * WIDTH:(y + 1) * WIDTH] for y in range(HEIGHT)]
+
+def write_pbm(path, rows):
+    with open(path, 'w') as f:
+        f.write('P1\n%u %u\n' % (WIDTH, HEIGHT))
+        f.write('\n'.join(rows) + '\n')
+
+if len(sys.argv) not in (3, 4):
+    sys.exit('usage: %s capture.txt out_dir [reference_dir]' % sys.argv[0])
+
+capture   = open(sys.argv[1], errors='replace').read()
+out_dir   = sys.argv[2]
+reference = sys.argv[3] if len(sys.argv) == 4 else None
+
+os.makedirs(out_dir, exist_ok=True)
+
+failed = 0
+count  = 0
+for n, rows in enumerate(frames(capture)):
+    name = '%u.pbm' % n
+    write_pbm(os.path.join(out_dir, name), rows)
+    count += 1
+
+    if reference:
+        ref_path = os.path.join(reference, name)
+        if not os.path.exists(ref_path):
+            print('%s: no reference' % name)
+            failed += 1
+            continue
+        ref  = read_pbm(ref_path)
+        diff = sum(a != b for r, s in zip(rows, ref) for a, b in zip(r, s))
+        if diff:
+            print('%s: %u pixels differ' % (name, diff))
+            failed += 1
+
+print('%u frames, %u differ' % (count, failed) if reference else '%u frames' % count)
+sys.exit(1 if failed else 0)
@@ -25,6 +25,7 @@
 #include "driver/eeprom.h"
 #include "driver/uart.h"
 #include "driver/bk4819.h"
+#include "helper/journal.h"
 #include "misc.h"
 #include "settings.h"
 #include "board.h"
@@ -39,22 +40,21 @@ void SETTINGS_SaveVfoIndices(void)
 {
 	uint8_t State[8];
 
-	#ifndef ENABLE_NOAA
-		EEPROM_ReadBuffer(0x0E80, State, sizeof(State));
-	#endif
-
 	State[0] = gEeprom.ScreenChannel[0];
 	State[1] = gEeprom.MrChannel[0];
 	State[2] = gEeprom.FreqChannel[0];
 	State[3] = gEeprom.ScreenChannel[1];
 	State[4] = gEeprom.MrChannel[1];
 	State[5] = gEeprom.FreqChannel[1];
+	JOURNAL_Write(JOURNAL_KEY_VFO_INDICES, State);
+
 	#ifdef ENABLE_NOAA
+		// NOAA channels don't fit in a journal record, they rarely change
+		EEPROM_ReadBuffer(0x0E80, State, sizeof(State));
 		State[6] = gEeprom.NoaaChannel[0];
 		State[7] = gEeprom.NoaaChannel[1];
+		EEPROM_WriteBuffer(0x0E80, State, true);
 	#endif
-
-	EEPROM_WriteBuffer(0x0E80, State, true);
 }
 
 void SETTINGS_SaveSettings(void)
@@ -215,7 +215,22 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 
 			((uint32_t *)State)[0] = pVFO->freq_config_RX.Frequency;
 			((uint32_t *)State)[1] = pVFO->TX_OFFSET_FREQUENCY;
-			EEPROM_WriteBuffer(OffsetVFO + 0, State, true);
+
+			if (!IS_MR_CHANNEL(Channel))
+			{	// tuning only changes the frequency, keep it in the journal
+				uint8_t Last[5];
+				uint8_t Home[8];
+
+				Last[0] = Channel;
+				memcpy(&Last[1], State, 4);
+				JOURNAL_Write(JOURNAL_KEY_VFO_A_FREQ + VFO, Last);
+
+				EEPROM_ReadBuffer(OffsetVFO + 0, Home, sizeof(Home));
+				if (memcmp(&Home[4], &State[4], 4) != 0)
+					EEPROM_WriteBuffer(OffsetVFO + 0, State, true);
+			}
+			else
+				EEPROM_WriteBuffer(OffsetVFO + 0, State, true);
 
 			State[0] =  pVFO->freq_config_RX.Code;
 			State[1] =  pVFO->freq_config_TX.Code;
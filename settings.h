@@ -98,6 +98,9 @@ enum {
 	ACTION_OPT_BLMIN_TMP_OFF, //BackLight Minimum Temporay OFF
 #endif
 	ACTION_OPT_BANDWIDTH,
+#ifdef ENABLE_PROFILER
+	ACTION_OPT_PROFILER,
+#endif
 	//ACTION_OPT_SPECTRUM,
 	ACTION_OPT_LEN
 };
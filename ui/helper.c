@@ -66,89 +66,184 @@ void UI_GenerateChannelStringEx(char *pString, const bool bShowPrefix, const uin
 		sprintf(pString, "%03u", ChannelNumber + 1);
 }
 
-void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width)
+// The fonts start at '!' and have one glyph per printable character, stored
+// row after row, every row is one 8 pixel page.
+typedef struct {
+	const uint8_t *pGlyphs;
+	uint8_t        Glyphs;
+	uint8_t        Columns;   // glyph width
+	uint8_t        Rows;
+	uint8_t        Lead;      // blank columns before the glyph
+#ifdef ENABLE_PROPORTIONAL_FONT
+	const FontAtlas_t *pAtlas;
+#endif
+} Font_t;
+
+#ifdef ENABLE_PROPORTIONAL_FONT
+	#define ATLAS(atlas) , &atlas
+#else
+	#define ATLAS(atlas)
+#endif
+
+static const Font_t gBig       = { &gFontBig[0][0],       ARRAY_SIZE(gFontBig),       ARRAY_SIZE(gFontBig[0]) / 2, 2, 0 ATLAS(gFontBigAtlas) };
+static const Font_t gSmall     = { &gFontSmall[0][0],     ARRAY_SIZE(gFontSmall),     ARRAY_SIZE(gFontSmall[0]),   1, 1 ATLAS(gFontSmallAtlas) };
+#ifdef ENABLE_SMALL_BOLD
+static const Font_t gSmallBold = { &gFontSmallBold[0][0], ARRAY_SIZE(gFontSmallBold), ARRAY_SIZE(gFontSmallBold[0]), 1, 1 ATLAS(gFontSmallBoldAtlas) };
+#endif
+
+// the scrolling text needs fixed widths, the proportional build uses it for nothing else
+#if !defined(ENABLE_PROPORTIONAL_FONT) || defined(ENABLE_PL_BAND)
+/*
+Copies the glyphs of Length characters to pLine starting at column X,
+columns from Limit on are clipped
+*/
+static void DrawText(const Font_t *pFont, const char *pString, size_t Length, unsigned int Spacing, uint8_t *pLine, unsigned int X, unsigned int Limit)
+{
+	const unsigned int GlyphSize = pFont->Columns * pFont->Rows;
+
+	for (size_t i = 0; i < Length; i++, X += Spacing)
+	{
+		const unsigned int Index = (unsigned int)(uint8_t)pString[i] - '!';
+		const unsigned int Ofs   = X + pFont->Lead;
+
+		if (Ofs >= Limit)
+			break;
+		if (Index >= pFont->Glyphs)
+			continue;   // space or no glyph
+
+		const uint8_t     *pGlyph  = pFont->pGlyphs + (Index * GlyphSize);
+		const unsigned int Columns = MIN(pFont->Columns, Limit - Ofs);
+
+		for (unsigned int Row = 0; Row < pFont->Rows; Row++)
+			memcpy(pLine + (Row * LCD_WIDTH) + Ofs, pGlyph + (Row * pFont->Columns), Columns);
+	}
+}
+#endif
+
+#ifdef ENABLE_PROPORTIONAL_FONT
+
+#define GLYPH_GAP 1   // blank columns between two proportional glyphs
+
+// columns taken by a character, the gap after it included
+static unsigned int GlyphWidth(const Font_t *pFont, char c)
 {
-	size_t i;
-	size_t Length = strlen(pString);
+	const FontAtlas_t *pAtlas = pFont->pAtlas;
+	const unsigned int Index  = (unsigned int)(uint8_t)c - '!';
+	unsigned int       Width  = 0;
 
-	if (End > Start)
-		Start += (((End - Start) - (Length * Width)) + 1) / 2;
+	if (Index < pFont->Glyphs)
+		Width = pAtlas->pOffset[Index + 1] - pAtlas->pOffset[Index];
+	return (Width ? Width : pAtlas->Space) + GLYPH_GAP;
+}
+
+// the glyphs of Length characters from the atlas at column X, clipped at Limit
+static void DrawAtlasText(const Font_t *pFont, const char *pString, size_t Length, uint8_t *pLine, unsigned int X, unsigned int Limit)
+{
+	const FontAtlas_t *pAtlas = pFont->pAtlas;
 
-	for (i = 0; i < Length; i++)
+	for (size_t i = 0; i < Length && X < Limit; i++)
 	{
-		const unsigned int ofs   = (unsigned int)Start + (i * Width);
-		if (pString[i] > ' ' && pString[i] < 127)
+		const unsigned int Index = (unsigned int)(uint8_t)pString[i] - '!';
+		const unsigned int Width = GlyphWidth(pFont, pString[i]);
+
+		if (Index < pFont->Glyphs)
 		{
-			const unsigned int index = pString[i] - ' ' - 1;
-			memmove(gFrameBuffer[Line + 0] + ofs, &gFontBig[index][0], 7);
-			memmove(gFrameBuffer[Line + 1] + ofs, &gFontBig[index][7], 7);
+			const unsigned int Offset  = pAtlas->pOffset[Index];
+			const unsigned int Columns = MIN(Width - GLYPH_GAP, Limit - X);
+
+			for (unsigned int Row = 0; Row < pFont->Rows; Row++)
+				memcpy(pLine + (Row * LCD_WIDTH) + X, pAtlas->pColumns + (Row * pAtlas->Stride) + Offset, Columns);
 		}
+		X += Width;
 	}
 }
 
-void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_t Line)
+// Widths of the strings in flash. The menu and list screens center the same
+// labels every frame, strings in RAM change under the same pointer and are
+// always measured.
+#define WIDTH_CACHE_SIZE 16
+
+extern const uint8_t _etext[];   // end of the flash image, firmware.ld
+
+static struct {
+	const char   *pString;
+	const Font_t *pFont;
+	uint16_t      Width;
+} gWidthCache[WIDTH_CACHE_SIZE];
+
+static unsigned int TextWidth(const Font_t *pFont, const char *pString, size_t Length)
+{
+	const bool   bLabel = (const uint8_t *)pString < _etext;
+	const size_t Slot   = ((uintptr_t)pString >> 2) % WIDTH_CACHE_SIZE;
+	unsigned int Width  = 0;
+
+	if (bLabel && gWidthCache[Slot].pString == pString && gWidthCache[Slot].pFont == pFont)
+		return gWidthCache[Slot].Width;
+
+	for (size_t i = 0; i < Length; i++)
+		Width += GlyphWidth(pFont, pString[i]);
+	if (Width > 0)
+		Width -= GLYPH_GAP;
+
+	if (bLabel) {
+		gWidthCache[Slot].pString = pString;
+		gWidthCache[Slot].pFont   = pFont;
+		gWidthCache[Slot].Width   = Width;
+	}
+	return Width;
+}
+
+#endif
+
+// centers the text between Start and End when End > Start, a Start past the
+// line end addresses the next line
+static void PrintText(const Font_t *pFont, const char *pString, unsigned int Spacing, uint8_t Start, uint8_t End, uint8_t Line)
 {
 	const size_t Length = strlen(pString);
-	size_t       i;
+	int          X      = Start;
 
-	const unsigned int char_width   = ARRAY_SIZE(gFontSmall[0]);
-	const unsigned int char_spacing = char_width + 1;
+	if (End > Start) {
+#ifdef ENABLE_PROPORTIONAL_FONT
+		X += (((int)(End - Start) - (int)TextWidth(pFont, pString, Length)) + 1) >> 1;
+#else
+		X += (((int)(End - Start) - (int)(Length * Spacing)) + 1) >> 1;   // rounds down when the text is wider
+#endif
+		if (X < 0)
+			X = 0;
+	}
 
-	if (End > Start)
-		Start += (((End - Start) - (Length * char_spacing)) + 1) / 2;
+#ifdef ENABLE_PROPORTIONAL_FONT
+	(void)Spacing;
+	DrawAtlasText(pFont, pString, Length, gFrameBuffer[Line + (X / LCD_WIDTH)], X % LCD_WIDTH, LCD_WIDTH);
+#else
+	DrawText(pFont, pString, Length, Spacing, gFrameBuffer[Line + (X / LCD_WIDTH)], X % LCD_WIDTH, LCD_WIDTH);
+#endif
+}
 
+void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width)
+{
+	PrintText(&gBig, pString, Width, Start, End, Line);
+}
 
-	uint8_t            *pFb         = gFrameBuffer[Line] + Start;
-	for (i = 0; i < Length; i++)
-	{
-		if (pString[i] > ' ')
-		{
-			const unsigned int index = (unsigned int)pString[i] - ' ' - 1;
-			if (index < ARRAY_SIZE(gFontSmall))
-				memmove(pFb + (i * char_spacing) + 1, &gFontSmall[index], char_width);
-		}
-	}
+void UI_PrintStringSmall(const char *pString, uint8_t Start, uint8_t End, uint8_t Line)
+{
+	PrintText(&gSmall, pString, gSmall.Columns + 1, Start, End, Line);
 }
 
 #ifdef ENABLE_SMALL_BOLD
 	void UI_PrintStringSmallBold(const char *pString, uint8_t Start, uint8_t End, uint8_t Line)
 	{
-		const size_t Length = strlen(pString);
-		size_t       i;
-	
-		const unsigned int char_width   = ARRAY_SIZE(gFontSmallBold[0]);
-		const unsigned int char_spacing = char_width + 1;
-
-		if (End > Start)
-			Start += (((End - Start) - (Length * char_spacing)) + 1) / 2;
-
-		uint8_t            *pFb         = gFrameBuffer[Line] + Start;
-		for (i = 0; i < Length; i++)
-		{
-			if (pString[i] > ' ')
-			{
-				const unsigned int index = (unsigned int)pString[i] - ' ' - 1;
-				if (index < ARRAY_SIZE(gFontSmallBold))
-					memmove(pFb + (i * char_spacing) + 1, &gFontSmallBold[index], char_width);
-			}
-		}
+		PrintText(&gSmallBold, pString, gSmallBold.Columns + 1, Start, End, Line);
 	}
 #endif
 
 void UI_PrintStringSmallBuffer(const char *pString, uint8_t *buffer)
 {
-	size_t i;
-	const unsigned int char_width   = ARRAY_SIZE(gFontSmall[0]);
-	const unsigned int char_spacing = char_width + 1;
-	for (i = 0; i < strlen(pString); i++)
-	{
-		if (pString[i] > ' ')
-		{
-			const unsigned int index = (unsigned int)pString[i] - ' ' - 1;
-			if (index < ARRAY_SIZE(gFontSmall))
-				memmove(buffer + (i * char_spacing) + 1, &gFontSmall[index], char_width);
-		}
-	}
+#ifdef ENABLE_PROPORTIONAL_FONT
+	DrawAtlasText(&gSmall, pString, strlen(pString), buffer, 0, LCD_WIDTH);
+#else
+	DrawText(&gSmall, pString, strlen(pString), gSmall.Columns + 1, buffer, 0, LCD_WIDTH);
+#endif
 }
 
 void UI_DisplayFrequency(const char *string, uint8_t X, uint8_t Y, bool center)
@@ -283,32 +378,75 @@ void PutPixelStatus(uint8_t x, uint8_t y, bool fill) {
   UI_DrawPixelBuffer(&gStatusLine, x, y, fill);
 }
 
+// one page byte at a time, masks for the partial top and bottom pages
 void DrawVLine(int sy, int ey, int nx, bool fill) {
-  for (int i = sy; i <= ey; i++) {
-    if (i < 56 && nx < 128) {
-      PutPixel(nx, i, fill);
-    }
+  if (sy < 0)
+    sy = 0;
+  if (ey > 55)
+    ey = 55;
+  if (sy > ey || nx < 0 || nx >= 128)
+    return;
+
+  for (int page = sy >> 3; page <= ey >> 3; page++) {
+    uint8_t mask = 0xFF;
+    if (page == sy >> 3)
+      mask &= 0xFF << (sy & 7);
+    if (page == ey >> 3)
+      mask &= 0xFF >> (7 - (ey & 7));
+
+    if (fill)
+      gFrameBuffer[page][nx] |= mask;
+    else
+      gFrameBuffer[page][nx] &= ~mask;
+  }
+}
+
+// every 'spacing' column of row y across the width of the screen
+void DrawDottedHLine(int y, int spacing, bool fill) {
+  if (y < 0 || y > 55 || spacing <= 0)
+    return;
+
+  uint8_t *pLine = gFrameBuffer[y >> 3];
+  const uint8_t mask = 1u << (y & 7);
+
+  for (int x = 0; x < 128; x += spacing) {
+    if (fill)
+      pLine[x] |= mask;
+    else
+      pLine[x] &= ~mask;
   }
 }
 
+// glyph columns are 6 bits high, shifted into the one or two pages they cover
 void GUI_DisplaySmallest(const char *pString, uint8_t x, uint8_t y,
                                 bool statusbar, bool fill) {
+  uint8_t (*buffer)[128] = statusbar ? &gStatusLine : gFrameBuffer;
+  const unsigned int pages = statusbar ? 1 : ARRAY_SIZE(gFrameBuffer);
+  const unsigned int page = y >> 3;
+  const unsigned int shift = y & 7;
   uint8_t c;
-  uint8_t pixels;
   const uint8_t *p = (const uint8_t *)pString;
 
+  if (page >= pages)
+    return;
+
   while ((c = *p++) && c != '\0') {
     c -= 0x20;
     for (int i = 0; i < 3; i++) {
-      pixels = gFont3x5[c][i];
-      for (int j = 0; j < 6; ++j) {
-        if (pixels & 1) {
-          if (statusbar)
-            PutPixelStatus(x + i, y + j, fill);
-          else
-            PutPixel(x + i, y + j, fill);
-        }
-        pixels >>= 1;
+      const unsigned int column = x + i;
+      const uint16_t bits = (gFont3x5[c][i] & 0x3F) << shift;
+
+      if (column >= 128)
+        return;
+
+      if (fill) {
+        buffer[page][column] |= bits;
+        if (page + 1 < pages)
+          buffer[page + 1][column] |= bits >> 8;
+      } else {
+        buffer[page][column] &= ~bits;
+        if (page + 1 < pages)
+          buffer[page + 1][column] &= ~(bits >> 8);
       }
     }
     x += 4;
@@ -350,30 +488,8 @@ void UI_PrintStringSmallScrolling(const char *pString, uint8_t Start, uint8_t En
         actualStart = Start + (((End - Start) - (totalDisplayChars * char_spacing)) + 1) / 2;
     }
     
-    uint8_t *pFb = gFrameBuffer[Line] + actualStart;
-    
-    // Draw main part from startChar
-    for (uint8_t i = 0; i < displayLength; i++)
-    {
-        char c = pString[startChar + i];
-        if (c > ' ')
-        {
-            const unsigned int index = (unsigned int)c - ' ' - 1;
-            if (index < ARRAY_SIZE(gFontSmall))
-                memmove(pFb + (i * char_spacing) + 1, &gFontSmall[index], char_width);
-        }
-    }
-    
-    // Draw wrapped part from beginning if needed
-    for (uint8_t i = 0; i < wrapChars; i++)
-    {
-        char c = pString[i];
-        if (c > ' ')
-        {
-            const unsigned int index = (unsigned int)c - ' ' - 1;
-            if (index < ARRAY_SIZE(gFontSmall))
-                memmove(pFb + ((displayLength + i) * char_spacing) + 1, &gFontSmall[index], char_width);
-        }
-    }
+    // Draw main part from startChar, then the wrapped part from the beginning
+    DrawText(&gSmall, pString + startChar, displayLength, char_spacing, gFrameBuffer[Line], actualStart, LCD_WIDTH);
+    DrawText(&gSmall, pString, wrapChars, char_spacing, gFrameBuffer[Line], actualStart + (displayLength * char_spacing), LCD_WIDTH);
 }
 #endif
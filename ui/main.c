@@ -29,6 +29,7 @@
 #include "external/printf/printf.h"
 #include "functions.h"
 #include "helper/battery.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
@@ -131,7 +132,7 @@ void UI_DisplayAudioBar(void)
 	DrawLevelBar(62, line, bars);
 
 	if (gCurrentFunction == FUNCTION_TRANSMIT)
-		ST7565_BlitFullScreen();
+		ST7565_BlitDirty();
 
 }
 #endif
@@ -180,10 +181,10 @@ static void DisplayRSSIBar(const int16_t rssi, const bool now)
 		uint8_t overS9Bars = MIN(sLevelAtt.over/10, 4);
 		
 		if(overS9Bars == 0) {
-			sprintf(str, "% 4d S%d", sLevelAtt.dBmRssi, sLevelAtt.sLevel); 
+			FORMAT_Unsigned(FORMAT_String(FORMAT_Signed(str, sLevelAtt.dBmRssi, 4, ' '), " S"), sLevelAtt.sLevel, 0, ' ');
 		}
 		else {
-			sprintf(str, "% 4d  %2d", sLevelAtt.dBmRssi, sLevelAtt.over);
+			FORMAT_Unsigned(FORMAT_String(FORMAT_Signed(str, sLevelAtt.dBmRssi, 4, ' '), "  "), sLevelAtt.over, 2, ' ');
 			memcpy(p_line + 2 + 7*5, &plus, ARRAY_SIZE(plus));
 		}
 
@@ -214,7 +215,7 @@ static void DisplayRSSIBar(const int16_t rssi, const bool now)
 #endif
 
 	if (now)
-		ST7565_BlitFullScreen();
+		ST7565_BlitDirty();
 }
 
 
@@ -235,483 +236,584 @@ void UI_UpdateRSSI(const int16_t rssi, const int vfo)
 }
 
 // ***************************************************************************
+// The main screen is made of widgets, every VFO panel has the same four and
+// the center line is shared. A widget owns a rectangle of the frame buffer and
+// is cleared and redrawn only when its bit is set in gDirtyWidgets.
+
+typedef struct {
+	uint8_t X;
+	uint8_t Width;
+	uint8_t Page;    // relative to the first line of the VFO panel
+	uint8_t Pages;
+} Widget_t;
+
+typedef struct {
+	unsigned int line;       // first text line of the panel
+	unsigned int mode;       // 1 = transmitting on this VFO, 2 = receiving
+	unsigned int state;
+	uint32_t     frequency;
+	bool         active;     // VFO being used for TX/RX
+	bool         inputting;  // user is entering a frequency into this VFO
+} Panel_t;
+
+static const Widget_t gWidgets[UI_MAIN_WIDGETS_PER_VFO] = {
+	{  0,  31, 0, 2 },   // UI_MAIN_CHANNEL
+	{ 31,  97, 0, 2 },   // UI_MAIN_FREQUENCY
+	{  0,  24, 2, 1 },   // UI_MAIN_LEVEL
+	{ 24, 104, 2, 1 },   // UI_MAIN_FLAGS
+};
+
+static uint16_t gDirtyWidgets = UI_MAIN_ALL;
+static bool     gLayoutValid;   // frame buffer holds the widget layout, not a popup or a taken over panel
+
+void UI_MAIN_Invalidate(uint16_t Widgets)
+{
+	gDirtyWidgets |= Widgets;
 
-void UI_DisplayMain(void)
+	// other screens don't have widgets, redraw them whole
+	if (gScreenToDisplay != DISPLAY_MAIN)
+		gUpdateDisplay = true;
+}
+
+static void ClearWidget(unsigned int line, unsigned int widget)
 {
-	const unsigned int line0 = 0;  // text screen line
-	const unsigned int line1 = 4;
-	char               String[22];
-	unsigned int       vfo_num;
+	const Widget_t *pWidget = &gWidgets[widget];
 
-	center_line = CENTER_LINE_NONE;
+	for (unsigned int page = 0; page < pWidget->Pages; page++)
+		memset(gFrameBuffer[line + pWidget->Page + page] + pWidget->X, 0, pWidget->Width);
+}
 
-	// clear the screen
-	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+// the panel of a VFO not used for TX/RX shows the scan range or the DTMF call instead
+static bool IsTakenOver(const unsigned int vfo_num, const unsigned int activeTxVFO)
+{
+	if (activeTxVFO == vfo_num)
+		return false;
 
-	if(gLowBattery && !gLowBatteryConfirmed) {
-		UI_DisplayPopup("LOW BATTERY");
-		ST7565_BlitFullScreen();
-		return;
-	}
+#ifdef ENABLE_SCAN_RANGES
+	if (gScanRangeStart)
+		return true;
+#endif
 
-	if (gEeprom.KEY_LOCK && gKeypadLocked > 0)
-	{	// tell user how to unlock the keyboard
-		UI_PrintString("Long press #", 0, LCD_WIDTH, 1, 8);
-		UI_PrintString("to unlock",    0, LCD_WIDTH, 3, 8);
-		ST7565_BlitFullScreen();
-		return;
-	}
-							
-	unsigned int activeTxVFO = gRxVfoIsActive ? gEeprom.RX_VFO : gEeprom.TX_VFO;
+	return
+#ifdef ENABLE_DTMF
+		gDTMF_CallState != DTMF_CALL_STATE_NONE || gDTMF_IsTx ||
+#endif
+		gDTMF_InputMode;
+}
 
-	for (vfo_num = 0; vfo_num < 2; vfo_num++)
-	{
-		const unsigned int line       = (vfo_num == 0) ? line0 : line1;
-		const bool         isMainVFO   = (vfo_num == gEeprom.TX_VFO);
-		uint8_t           *p_line0    = gFrameBuffer[line + 0];
-		uint8_t           *p_line1    = gFrameBuffer[line + 1];
-		unsigned int       mode       = 0;
+static void DrawTakenOver(const unsigned int vfo_num, const unsigned int line, char *String)
+{
+	(void)line;
 
-		if (activeTxVFO != vfo_num) // this is not active TX VFO
-		{
 #ifdef ENABLE_SCAN_RANGES
-			if(gScanRangeStart) {
-					UI_PrintString("ScnRng", 5, 0, line, 8);
-					sprintf(String, "%3u.%05u", gScanRangeStart / 100000, gScanRangeStart % 100000);
-					UI_PrintStringSmall(String, 56, 0, line);
-					sprintf(String, "%3u.%05u", gScanRangeStop / 100000, gScanRangeStop % 100000);
-					UI_PrintStringSmall(String, 56, 0, line + 1);
-					
-				continue;
-			}
+	if(gScanRangeStart) {
+			UI_PrintString("ScnRng", 5, 0, line, 8);
+			sprintf(String, "%3u.%05u", gScanRangeStart / 100000, gScanRangeStart % 100000);
+			UI_PrintStringSmall(String, 56, 0, line);
+			sprintf(String, "%3u.%05u", gScanRangeStop / 100000, gScanRangeStop % 100000);
+			UI_PrintStringSmall(String, 56, 0, line + 1);
+			
+		return;
+	}
 #endif
 
-
-			if (
-#ifdef ENABLE_DTMF
-				gDTMF_CallState != DTMF_CALL_STATE_NONE || gDTMF_IsTx || 
-#endif				
-				gDTMF_InputMode)
-			{	// show DTMF stuff
+	// show DTMF stuff
 #ifdef ENABLE_DTMF
-				char Contact[16];
-
-				if (!gDTMF_InputMode)
-				{
-
-					memset(Contact, 0, sizeof(Contact));
-					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
-						strcpy(String, (gDTMF_State == DTMF_STATE_CALL_OUT_RSP) ? "CALL OUT(RSP)" : "CALL OUT");
-					else
-					if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
-						sprintf(String, "CALL FRM:%s", (DTMF_FindContact(gDTMF_Caller, Contact)) ? Contact : gDTMF_Caller);
-					else
-					if (gDTMF_IsTx)
-						strcpy(String, (gDTMF_State == DTMF_STATE_TX_SUCC) ? "DTMF TX(SUCC)" : "DTMF TX");
-				}
-				else
+	char Contact[16];
+
+	if (!gDTMF_InputMode)
+	{
+
+		memset(Contact, 0, sizeof(Contact));
+		if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
+			strcpy(String, (gDTMF_State == DTMF_STATE_CALL_OUT_RSP) ? "CALL OUT(RSP)" : "CALL OUT");
+		else
+		if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
+			sprintf(String, "CALL FRM:%s", (DTMF_FindContact(gDTMF_Caller, Contact)) ? Contact : gDTMF_Caller);
+		else
+		if (gDTMF_IsTx)
+			strcpy(String, (gDTMF_State == DTMF_STATE_TX_SUCC) ? "DTMF TX(SUCC)" : "DTMF TX");
+	}
+	else
 #endif				
-				{
-					sprintf(String, ">%s", gDTMF_InputBox);
-				}
-				UI_PrintString(String, 2, 0, 0 + (vfo_num * 3), 8);
+	{
+		sprintf(String, ">%s", gDTMF_InputBox);
+	}
+	UI_PrintString(String, 2, 0, 0 + (vfo_num * 3), 8);
 #ifdef ENABLE_DTMF
-				memset(String,  0, sizeof(String));
-				if (!gDTMF_InputMode) {
-					memset(Contact, 0, sizeof(Contact));
-					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
-						sprintf(String, ">%s", (DTMF_FindContact(gDTMF_String, Contact)) ? Contact : gDTMF_String);
-					else
-					if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
-						sprintf(String, ">%s", (DTMF_FindContact(gDTMF_Callee, Contact)) ? Contact : gDTMF_Callee);
-					else
-					if (gDTMF_IsTx)
-						sprintf(String, ">%s", gDTMF_String);
-				}
+	memset(String,  0, 22);
+	if (!gDTMF_InputMode) {
+		memset(Contact, 0, sizeof(Contact));
+		if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT)
+			sprintf(String, ">%s", (DTMF_FindContact(gDTMF_String, Contact)) ? Contact : gDTMF_String);
+		else
+		if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED || gDTMF_CallState == DTMF_CALL_STATE_RECEIVED_STAY)
+			sprintf(String, ">%s", (DTMF_FindContact(gDTMF_Callee, Contact)) ? Contact : gDTMF_Callee);
+		else
+		if (gDTMF_IsTx)
+			sprintf(String, ">%s", gDTMF_String);
+	}
 
-				UI_PrintString(String, 2, 0, 2 + (vfo_num * 3), 8);
+	UI_PrintString(String, 2, 0, 2 + (vfo_num * 3), 8);
 #endif
-				center_line = CENTER_LINE_IN_USE;
-				continue;
-			}
+	center_line = CENTER_LINE_IN_USE;
+}
 
-			// highlight the selected/used VFO with a marker
-			if (isMainVFO)
-				memmove(p_line0 + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
-		}
-		else // active TX VFO
-		{	// highlight the selected/used VFO with a marker
-			if (isMainVFO)
-				memmove(p_line0 + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
-			else
-				memmove(p_line0 + 0, BITMAP_VFO_NotDefault, sizeof(BITMAP_VFO_NotDefault));
-		}
+static void GetPanel(Panel_t *pPanel, const unsigned int vfo_num, const unsigned int activeTxVFO)
+{
+	pPanel->line      = (vfo_num == 0) ? 0 : 4;
+	pPanel->mode      = 0;
+	pPanel->active    = (activeTxVFO == vfo_num);
+	pPanel->state     = VfoState[vfo_num];
+	pPanel->frequency = gEeprom.VfoInfo[vfo_num].pRX->Frequency;
 
-		if (gCurrentFunction == FUNCTION_TRANSMIT)
-		{	// transmitting
+	if (gCurrentFunction == FUNCTION_TRANSMIT)
+	{	// transmitting
+#ifdef ENABLE_ALARM
+		if (gAlarmState == ALARM_STATE_ALARM)
+			pPanel->mode = 2;
+		else
+#endif
+		if (pPanel->active)
+			pPanel->mode = 1;
+	}
+	else
+		pPanel->mode = 2;   // receiving
 
 #ifdef ENABLE_ALARM
-			if (gAlarmState == ALARM_STATE_ALARM)
-				mode = 2;
-			else
+	if (gCurrentFunction == FUNCTION_TRANSMIT && gAlarmState == ALARM_STATE_ALARM) {
+		if (pPanel->active)
+			pPanel->state = VFO_STATE_ALARM;
+	}
 #endif
-			{
-				if (activeTxVFO == vfo_num)
-				{	// show the TX symbol
-					mode = 1;
+
+	pPanel->inputting = pPanel->state == VFO_STATE_NORMAL && gInputBoxIndex > 0 &&
+		IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]) && gEeprom.TX_VFO == vfo_num;
+
+	if (gCurrentFunction == FUNCTION_TRANSMIT && pPanel->active)
+		pPanel->frequency = gEeprom.VfoInfo[vfo_num].pTX->Frequency;
+}
+
+// VFO marker, TX/RX symbol and channel number
+static void DrawChannel(const unsigned int vfo_num, const Panel_t *pPanel, char *String)
+{
+	const unsigned int line = pPanel->line;
+
+	// highlight the selected/used VFO with a marker
+	if (vfo_num == gEeprom.TX_VFO)
+		memmove(gFrameBuffer[line] + 0, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
+	else if (pPanel->active)
+		memmove(gFrameBuffer[line] + 0, BITMAP_VFO_NotDefault, sizeof(BITMAP_VFO_NotDefault));
+
+	if (pPanel->mode == 1)
+	{	// show the TX symbol
 #ifdef ENABLE_SMALL_BOLD
-					UI_PrintStringSmallBold("TX", 14, 0, line);
+		UI_PrintStringSmallBold("TX", 14, 0, line);
 #else
-					UI_PrintStringSmall("TX", 14, 0, line);
+		UI_PrintStringSmall("TX", 14, 0, line);
 #endif
-				}
-			}
-		}
-		else
-		{	// receiving .. show the RX symbol
-			mode = 2;
-			if ((gCurrentFunction == FUNCTION_RECEIVE ||
-			     gCurrentFunction == FUNCTION_MONITOR ||
-			     gCurrentFunction == FUNCTION_INCOMING) &&
-			     gEeprom.RX_VFO == vfo_num)
-			{
+	}
+	else
+	if (pPanel->mode == 2 &&
+	    (gCurrentFunction == FUNCTION_RECEIVE ||
+	     gCurrentFunction == FUNCTION_MONITOR ||
+	     gCurrentFunction == FUNCTION_INCOMING) &&
+	     gEeprom.RX_VFO == vfo_num)
+	{	// receiving .. show the RX symbol
 #ifdef ENABLE_SMALL_BOLD
-				UI_PrintStringSmallBold("RX", 14, 0, line);
+		UI_PrintStringSmallBold("RX", 14, 0, line);
 #else
-				UI_PrintStringSmall("RX", 14, 0, line);
+		UI_PrintStringSmall("RX", 14, 0, line);
 #endif
-			}
-		}
+	}
 
-		if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
-		{	// channel mode
-			const unsigned int x = 2;
-			const bool inputting = (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num) ? false : true;
-			if (!inputting)
-				sprintf(String, "M%u", gEeprom.ScreenChannel[vfo_num] + 1);
-			else
-				sprintf(String, "M%.3s", INPUTBOX_GetAscii());  // show the input text
-			UI_PrintStringSmall(String, x, 0, line + 1);
-		}
-		//Robby69 removed
-		/*else if (IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
-		{	// frequency mode
-			// show the frequency band number //Robby69 removed
-			const unsigned int x = 2;
-			char * buf = gEeprom.VfoInfo[vfo_num].pRX->Frequency < 100000000 ? "" : "+";
-			sprintf(String, "F%u%s", 1 + gEeprom.ScreenChannel[vfo_num] - FREQ_CHANNEL_FIRST, buf);
-			UI_PrintStringSmall(String, x, 0, line + 1);
-		}*/
+	if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
+	{	// channel mode
+		const unsigned int x = 2;
+		const bool inputting = (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num) ? false : true;
+		if (!inputting)
+			sprintf(String, "M%u", gEeprom.ScreenChannel[vfo_num] + 1);
+		else
+			sprintf(String, "M%.3s", INPUTBOX_GetAscii());  // show the input text
+		UI_PrintStringSmall(String, x, 0, line + 1);
+	}
 #ifdef ENABLE_NOAA
+	else
+	{
+		if (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num)
+		{	// channel number
+			sprintf(String, "N%u", 1 + gEeprom.ScreenChannel[vfo_num] - NOAA_CHANNEL_FIRST);
+		}
 		else
-		{
-			if (gInputBoxIndex == 0 || gEeprom.TX_VFO != vfo_num)
-			{	// channel number
-				sprintf(String, "N%u", 1 + gEeprom.ScreenChannel[vfo_num] - NOAA_CHANNEL_FIRST);
-			}
-			else
-			{	// user entering channel number
-				sprintf(String, "N%u%u", '0' + gInputBox[0], '0' + gInputBox[1]);
-			}
-			UI_PrintStringSmall(String, 7, 0, line + 1);
+		{	// user entering channel number
+			sprintf(String, "N%u%u", '0' + gInputBox[0], '0' + gInputBox[1]);
 		}
+		UI_PrintStringSmall(String, 7, 0, line + 1);
+	}
 #endif
+}
 
-		// ************
-
-		unsigned int state = VfoState[vfo_num];
-
-#ifdef ENABLE_ALARM
-		if (gCurrentFunction == FUNCTION_TRANSMIT && gAlarmState == ALARM_STATE_ALARM) {
-			if (activeTxVFO == vfo_num)
-				state = VFO_STATE_ALARM;
-		}
+static void DrawFrequencyText(char *String, const unsigned int line)
+{
+#ifdef ENABLE_BIG_FREQ
+	if(String[3] == '.') {
+		// show the remaining 2 small frequency digits
+		UI_PrintStringSmall(String + 7, 113, 0, line + 1);
+		String[7] = 0;
+		// show the main large frequency digits
+		UI_DisplayFrequency(String, 32, line, false);
+	}
+	else
 #endif
+	{
+		// show the frequency in the main font
+		UI_PrintString(String, 32, 0, line, 8);
+	}
+}
 
-		uint32_t frequency = gEeprom.VfoInfo[vfo_num].pRX->Frequency;
+// frequency, channel name or VFO state
+static void DrawFrequency(const unsigned int vfo_num, const Panel_t *pPanel, char *String)
+{
+	const unsigned int line      = pPanel->line;
+	const uint32_t     frequency = pPanel->frequency;
 
-		if (state != VFO_STATE_NORMAL)
-		{
-			const char *state_list[] = {"", "BUSY", "BAT LOW", "TX DISABLE", "TIMEOUT", "ALARM", "VOLT HIGH"};
-			if (state < ARRAY_SIZE(state_list))
-				UI_PrintString(state_list[state], 31, 0, line, 8);
+	if (pPanel->state != VFO_STATE_NORMAL)
+	{
+		const char *state_list[] = {"", "BUSY", "BAT LOW", "TX DISABLE", "TIMEOUT", "ALARM", "VOLT HIGH"};
+		if (pPanel->state < ARRAY_SIZE(state_list))
+			UI_PrintString(state_list[pPanel->state], 31, 0, line, 8);
+	}
+	else if (pPanel->inputting)
+	{	// user entering a frequency
+		const char * ascii = INPUTBOX_GetAscii();
+		bool isGigaF = frequency>=100000000;
+		sprintf(String, "%.*s.%.3s", 3 + isGigaF, ascii, ascii + 3 + isGigaF);
+		DrawFrequencyText(String, line);
+	}
+	else if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
+	{	// it's a channel
+
+		// show the scan list assigment symbols
+		const ChannelAttributes_t att = gMR_ChannelAttributes[gEeprom.ScreenChannel[vfo_num]];
+		if (att.scanlist > 0) {
+			sprintf(String, "%d", att.scanlist);
+			UI_PrintStringSmall(String, 113, 0, line + 1);
 		}
-		else if (gInputBoxIndex > 0 && IS_FREQ_CHANNEL(gEeprom.ScreenChannel[vfo_num]) && gEeprom.TX_VFO == vfo_num)
-		{	// user entering a frequency
-			const char * ascii = INPUTBOX_GetAscii();
-			bool isGigaF = frequency>=100000000;
-			sprintf(String, "%.*s.%.3s", 3 + isGigaF, ascii, ascii + 3 + isGigaF);
-#ifdef ENABLE_BIG_FREQ
-			if(!isGigaF) {
-				// show the remaining 2 small frequency digits
-				UI_PrintStringSmall(String + 7, 113, 0, line + 1);
-				String[7] = 0;
-				// show the main large frequency digits
-				UI_DisplayFrequency(String, 32, line, false);
-			}
-			else
+
+		// compander symbol
+#ifndef ENABLE_BIG_FREQ
+		if (att.compander)
+			memmove(gFrameBuffer[line] + 120 + LCD_WIDTH, BITMAP_compand, sizeof(BITMAP_compand));
+#else
+		// TODO:  // find somewhere else to put the symbol
 #endif
-			{
-				// show the frequency in the main font
-				UI_PrintString(String, 32, 0, line, 8);
-			}
 
-			continue;
-		}
-		else
+		switch (gEeprom.CHANNEL_DISPLAY_MODE)
 		{
-			if (gCurrentFunction == FUNCTION_TRANSMIT)
-			{	// transmitting
-				if (activeTxVFO == vfo_num)
-					frequency = gEeprom.VfoInfo[vfo_num].pTX->Frequency;
-			}
+			case MDF_FREQUENCY:	// show the channel frequency
+				sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
+				DrawFrequencyText(String, line);
+				break;
 
-			if (IS_MR_CHANNEL(gEeprom.ScreenChannel[vfo_num]))
-			{	// it's a channel
+			case MDF_CHANNEL:	// show the channel number
+				sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
+				UI_PrintString(String, 32, 0, line, 8);
+				break;
 
-				// show the scan list assigment symbols
-				const ChannelAttributes_t att = gMR_ChannelAttributes[gEeprom.ScreenChannel[vfo_num]];
-				if (att.scanlist > 0) {
-					sprintf(String, "%d", att.scanlist);
-					UI_PrintStringSmall(String, 113, 0, line + 1);
-				}
+			case MDF_NAME:		// show the channel name
+			case MDF_NAME_FREQ:	// show the channel name and frequency
 
-				// compander symbol
-#ifndef ENABLE_BIG_FREQ
-				if (att.compander)
-					memmove(p_line0 + 120 + LCD_WIDTH, BITMAP_compand, sizeof(BITMAP_compand));
-#else
-				// TODO:  // find somewhere else to put the symbol
-#endif
+				SETTINGS_FetchChannelName(String, gEeprom.ScreenChannel[vfo_num]);
+				if (String[0] == 0)
+				{	// no channel name, show the channel number instead
+					sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
+				}
 
-				switch (gEeprom.CHANNEL_DISPLAY_MODE)
-				{
-					case MDF_FREQUENCY:	// show the channel frequency
-						sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
-#ifdef ENABLE_BIG_FREQ
-						if(frequency < 100000000) {
-							// show the remaining 2 small frequency digits
-							UI_PrintStringSmall(String + 7, 113, 0, line + 1);
-							String[7] = 0;
-							// show the main large frequency digits
-							UI_DisplayFrequency(String, 32, line, false);
-						}
-						else
-#endif
-						{
-							// show the frequency in the main font
-							UI_PrintString(String, 32, 0, line, 8);
-						}
-
-						break;
-
-					case MDF_CHANNEL:	// show the channel number
-						sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
-						UI_PrintString(String, 32, 0, line, 8);
-						break;
-
-					case MDF_NAME:		// show the channel name
-					case MDF_NAME_FREQ:	// show the channel name and frequency
-
-						SETTINGS_FetchChannelName(String, gEeprom.ScreenChannel[vfo_num]);
-						if (String[0] == 0)
-						{	// no channel name, show the channel number instead
-							sprintf(String, "CH-%03u", gEeprom.ScreenChannel[vfo_num] + 1);
-						}
-
-						if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_NAME) {
-							UI_PrintString(String, 32, 0, line, 8);
-						}
-						else {
+				if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_NAME) {
+					UI_PrintString(String, 32, 0, line, 8);
+				}
+				else {
 #ifdef ENABLE_SMALL_BOLD
-							UI_PrintStringSmallBold(String, 32 + 4, 0, line);
+					UI_PrintStringSmallBold(String, 32 + 4, 0, line);
 #else
-							UI_PrintStringSmall(String, 32 + 4, 0, line);
+					UI_PrintStringSmall(String, 32 + 4, 0, line);
 #endif
-							// show the channel frequency below the channel number/name
-							sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
-							UI_PrintStringSmall(String, 32 + 4, 0, line + 1);
-						}
-
-						break;
+					// show the channel frequency below the channel number/name
+					sprintf(String, "%03u.%05u", frequency / 100000, frequency % 100000);
+					UI_PrintStringSmall(String, 32 + 4, 0, line + 1);
 				}
-			}
-			else
-			{	// frequency mode
-				sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
 
-#ifdef ENABLE_BIG_FREQ
-				if(frequency < 100000000) {
-					// show the remaining 2 small frequency digits
-					UI_PrintStringSmall(String + 7, 113, 0, line + 1);
-					String[7] = 0;
-					// show the main large frequency digits
-					UI_DisplayFrequency(String, 32, line, false);
-				}
-				else
-#endif
-				{
-					// show the frequency in the main font
-					UI_PrintString(String, 32, 0, line, 8);
-				}
-			}
+				break;
 		}
+	}
+	else
+	{	// frequency mode
+		sprintf(String, "%3u.%05u", frequency / 100000, frequency % 100000);
+		DrawFrequencyText(String, line);
+	}
+}
 
-		// ************
+// TX power or RX signal level, PTT toggle mode
+static void DrawLevel(const unsigned int vfo_num, const Panel_t *pPanel, char *String)
+{
+	uint8_t Level = 0;
 
-		{	// show the TX/RX level
-			uint8_t Level = 0;
+	(void)vfo_num;
+	(void)String;
 
-			if (mode == 1)
-			{	// TX power level
-	
-				switch (gRxVfo->OUTPUT_POWER)
-				{
-					case OUTPUT_POWER_LOW:  Level = 2; break;
-					case OUTPUT_POWER_MID:  Level = 4; break;
-					case OUTPUT_POWER_HIGH: Level = 6; break;
-	  
-				}
-			}
-			else 
-			if (mode == 2)
-			{	// RX signal level
-				#ifndef ENABLE_RSSI_BAR
-					// bar graph
-					if (gVFO_RSSI_bar_level[vfo_num] > 0)
-						Level = gVFO_RSSI_bar_level[vfo_num];
-				#endif
-			}
-			if(Level)
-				DrawSmallAntennaAndBars(p_line1 + LCD_WIDTH, Level);
-		}
-		// ************
-
-		String[0] = '\0';
-
-		// show the modulation symbol
-		const char * s = "";
-		const ModulationMode_t mod = gEeprom.VfoInfo[vfo_num].Modulation;
-		switch (mod){
-			case MODULATION_FM: {
-				const FREQ_Config_t *pConfig = (mode == 1) ? gEeprom.VfoInfo[vfo_num].pTX : gEeprom.VfoInfo[vfo_num].pRX;
-				const unsigned int code_type = pConfig->CodeType;
-				const char *code_list[] = {"FM", "CT", "DCS", "DCR"};
-				if (code_type < ARRAY_SIZE(code_list))
-					s = code_list[code_type];
-				break;
-			}
-			default:
-				s = gModulationStr[mod];
-			break;
-		}		
-		UI_PrintStringSmall(s, LCD_WIDTH + 25, 0, line + 1);
+	if (pPanel->inputting)
+		return;
 
-		// show the Ptt_Toggle_Mode
-		
-		if (Ptt_Toggle_Mode) 	UI_PrintStringSmall("T", LCD_WIDTH + 0, 0, line + 1);
-
-		if (state == VFO_STATE_NORMAL || state == VFO_STATE_ALARM)
-		{	// show the TX power
-			const char pwr_list[] = "LMH";
-			const unsigned int i = gEeprom.VfoInfo[vfo_num].OUTPUT_POWER;
-			String[0] = (i < ARRAY_SIZE(pwr_list)) ? pwr_list[i] : '\0';
-			String[1] = '\0';
-			UI_PrintStringSmall(String, LCD_WIDTH + 50, 0, line + 1);
-		}
+	if (pPanel->mode == 1)
+	{	// TX power level
+
+		switch (gRxVfo->OUTPUT_POWER)
+		{
+			case OUTPUT_POWER_LOW:  Level = 2; break;
+			case OUTPUT_POWER_MID:  Level = 4; break;
+			case OUTPUT_POWER_HIGH: Level = 6; break;
 
-		if (gEeprom.VfoInfo[vfo_num].freq_config_RX.Frequency != gEeprom.VfoInfo[vfo_num].freq_config_TX.Frequency)
-		{	// show the TX offset symbol
-			const char dir_list[] = "\0+-";
-			const unsigned int i = gEeprom.VfoInfo[vfo_num].TX_OFFSET_FREQUENCY_DIRECTION;
-			String[0] = (i < sizeof(dir_list)) ? dir_list[i] : '?';
-			String[1] = '\0';
-			UI_PrintStringSmall(String, LCD_WIDTH + 60, 0, line + 1);
 		}
+	}
+	else 
+	if (pPanel->mode == 2)
+	{	// RX signal level
+		#ifndef ENABLE_RSSI_BAR
+			// bar graph
+			if (gVFO_RSSI_bar_level[vfo_num] > 0)
+				Level = gVFO_RSSI_bar_level[vfo_num];
+		#endif
+	}
+	if(Level)
+		DrawSmallAntennaAndBars(gFrameBuffer[pPanel->line + 2], Level);
+
+	// show the Ptt_Toggle_Mode
+	if (Ptt_Toggle_Mode) 	UI_PrintStringSmall("T", 0, 0, pPanel->line + 2);
+}
 
-		// show the TX/RX reverse symbol
-		if (gEeprom.VfoInfo[vfo_num].FrequencyReverse)
-			UI_PrintStringSmall("R", LCD_WIDTH + 62, 0, line + 1);
+// modulation, power, offset, bandwidth, DTMF and scrambler symbols
+static void DrawFlags(const unsigned int vfo_num, const Panel_t *pPanel, char *String)
+{
+	const unsigned int line = pPanel->line;
+
+	if (pPanel->inputting)
+		return;
 
-		{	// show the narrow band symbol
-			UI_PrintStringSmall(bwNames[gEeprom.VfoInfo[vfo_num].CHANNEL_BANDWIDTH], LCD_WIDTH + 70, 0, line + 1);
+	String[0] = '\0';
+
+	// show the modulation symbol
+	const char * s = "";
+	const ModulationMode_t mod = gEeprom.VfoInfo[vfo_num].Modulation;
+	switch (mod){
+		case MODULATION_FM: {
+			const FREQ_Config_t *pConfig = (pPanel->mode == 1) ? gEeprom.VfoInfo[vfo_num].pTX : gEeprom.VfoInfo[vfo_num].pRX;
+			const unsigned int code_type = pConfig->CodeType;
+			const char *code_list[] = {"FM", "CT", "DCS", "DCR"};
+			if (code_type < ARRAY_SIZE(code_list))
+				s = code_list[code_type];
+			break;
 		}
+		default:
+			s = gModulationStr[mod];
+		break;
+	}		
+	UI_PrintStringSmall(s, LCD_WIDTH + 25, 0, line + 1);
+
+	if (pPanel->state == VFO_STATE_NORMAL || pPanel->state == VFO_STATE_ALARM)
+	{	// show the TX power
+		const char pwr_list[] = "LMH";
+		const unsigned int i = gEeprom.VfoInfo[vfo_num].OUTPUT_POWER;
+		String[0] = (i < ARRAY_SIZE(pwr_list)) ? pwr_list[i] : '\0';
+		String[1] = '\0';
+		UI_PrintStringSmall(String, LCD_WIDTH + 50, 0, line + 1);
+	}
+
+	if (gEeprom.VfoInfo[vfo_num].freq_config_RX.Frequency != gEeprom.VfoInfo[vfo_num].freq_config_TX.Frequency)
+	{	// show the TX offset symbol
+		const char dir_list[] = "\0+-";
+		const unsigned int i = gEeprom.VfoInfo[vfo_num].TX_OFFSET_FREQUENCY_DIRECTION;
+		String[0] = (i < sizeof(dir_list)) ? dir_list[i] : '?';
+		String[1] = '\0';
+		UI_PrintStringSmall(String, LCD_WIDTH + 60, 0, line + 1);
+	}
+
+	// show the TX/RX reverse symbol
+	if (gEeprom.VfoInfo[vfo_num].FrequencyReverse)
+		UI_PrintStringSmall("R", LCD_WIDTH + 62, 0, line + 1);
+
+	{	// show the narrow band symbol
+		UI_PrintStringSmall(bwNames[gEeprom.VfoInfo[vfo_num].CHANNEL_BANDWIDTH], LCD_WIDTH + 70, 0, line + 1);
+	}
 
 #ifdef ENABLE_DTMF
-		// show the DTMF decoding symbol
-		if (gEeprom.VfoInfo[vfo_num].DTMF_DECODING_ENABLE || gSetting_KILLED)
-			UI_PrintStringSmall("DTMF", LCD_WIDTH + 78, 0, line + 1);
+	// show the DTMF decoding symbol
+	if (gEeprom.VfoInfo[vfo_num].DTMF_DECODING_ENABLE || gSetting_KILLED)
+		UI_PrintStringSmall("DTMF", LCD_WIDTH + 78, 0, line + 1);
 #endif
 
-		// show the audio scramble symbol
-		if (gEeprom.VfoInfo[vfo_num].SCRAMBLING_TYPE > 0 && gSetting_ScrambleEnable)
-			UI_PrintStringSmall("SCR", LCD_WIDTH + 106, 0, line + 1);
-	}
+	// show the audio scramble symbol
+	if (gEeprom.VfoInfo[vfo_num].SCRAMBLING_TYPE > 0 && gSetting_ScrambleEnable)
+		UI_PrintStringSmall("SCR", LCD_WIDTH + 106, 0, line + 1);
+}
 
-	if (center_line == CENTER_LINE_NONE)
-	{	// we're free to use the middle line
+static void (* const gWidgetDraw[UI_MAIN_WIDGETS_PER_VFO])(const unsigned int vfo_num, const Panel_t *pPanel, char *String) = {
+	DrawChannel,
+	DrawFrequency,
+	DrawLevel,
+	DrawFlags,
+};
 
-		const bool rx = (gCurrentFunction == FUNCTION_RECEIVE ||
-		                 gCurrentFunction == FUNCTION_MONITOR ||
-		                 gCurrentFunction == FUNCTION_INCOMING);
+// S-meter, TX audio bar or live DTMF decoder
+static void DrawCenterLine(char *String)
+{
+	const bool rx = (gCurrentFunction == FUNCTION_RECEIVE ||
+	                 gCurrentFunction == FUNCTION_MONITOR ||
+	                 gCurrentFunction == FUNCTION_INCOMING);
+
+	(void)rx;
+	(void)String;
+
+	memset(gFrameBuffer[3], 0, LCD_WIDTH);
 
 #ifdef ENABLE_AUDIO_BAR
-		if (gCurrentFunction == FUNCTION_TRANSMIT) {
-			center_line = CENTER_LINE_AUDIO_BAR;
-			UI_DisplayAudioBar();
-		}
-		//else
+	if (gCurrentFunction == FUNCTION_TRANSMIT) {
+		center_line = CENTER_LINE_AUDIO_BAR;
+		UI_DisplayAudioBar();
+	}
+	//else
 #endif
 
 #ifdef ENABLE_RSSI_BAR
-		if (rx) {
-			center_line = CENTER_LINE_RSSI;
-			DisplayRSSIBar(gCurrentRSSI[gEeprom.RX_VFO], false);
-		}
-		//else
+	if (rx) {
+		center_line = CENTER_LINE_RSSI;
+		DisplayRSSIBar(gCurrentRSSI[gEeprom.RX_VFO], false);
+	}
+	//else
 #endif
 #ifdef ENABLE_DTMF
-		if (rx || gCurrentFunction == FUNCTION_FOREGROUND || gCurrentFunction == FUNCTION_POWER_SAVE)
-		{
+	if (rx || gCurrentFunction == FUNCTION_FOREGROUND || gCurrentFunction == FUNCTION_POWER_SAVE)
+	{
 
-				if (gSetting_live_DTMF_decoder && gDTMF_RX_live[0] != 0)
-				{	// show live DTMF decode
-					const unsigned int len = strlen(gDTMF_RX_live);
-					const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
+			if (gSetting_live_DTMF_decoder && gDTMF_RX_live[0] != 0)
+			{	// show live DTMF decode
+				const unsigned int len = strlen(gDTMF_RX_live);
+				const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
 
 
-					if (gScreenToDisplay != DISPLAY_MAIN
-						|| gDTMF_CallState != DTMF_CALL_STATE_NONE
-						)
-						return;
-						
-					center_line = CENTER_LINE_DTMF_DEC;
+				if (gScreenToDisplay != DISPLAY_MAIN
+					|| gDTMF_CallState != DTMF_CALL_STATE_NONE
+					)
+					return;
 					
-					strcpy(String, "DTMF ");
-					strcat(String, gDTMF_RX_live + idx);
-					UI_PrintStringSmall(String, 2, 0, 3);
-				}
-				if (gSetting_live_DTMF_decoder && gDTMF_RX_index > 0)
-				{	// show live DTMF decode
-					const unsigned int len = gDTMF_RX_index;
-					const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
+				center_line = CENTER_LINE_DTMF_DEC;
+				
+				strcpy(String, "DTMF ");
+				strcat(String, gDTMF_RX_live + idx);
+				UI_PrintStringSmall(String, 2, 0, 3);
+			}
+			if (gSetting_live_DTMF_decoder && gDTMF_RX_index > 0)
+			{	// show live DTMF decode
+				const unsigned int len = gDTMF_RX_index;
+				const unsigned int idx = (len > (17 - 5)) ? len - (17 - 5) : 0;  // limit to last 'n' chars
+
+				if (gScreenToDisplay != DISPLAY_MAIN ||
+					gDTMF_CallState != DTMF_CALL_STATE_NONE)
+					return;
+
+				center_line = CENTER_LINE_DTMF_DEC;
+				
+				strcpy(String, "DTMF ");
+				strcat(String, gDTMF_RX + idx);
+				UI_PrintStringSmall(String, 2, 0, 3);
+			}
+
+	}
+#endif
+}
 
-					if (gScreenToDisplay != DISPLAY_MAIN ||
-						gDTMF_CallState != DTMF_CALL_STATE_NONE)
-						return;
+/*
+Redraws the widgets marked by UI_MAIN_Invalidate, nothing to do when none are
+*/
+void UI_MAIN_Update(void)
+{
+	char           String[22];
+	uint16_t       dirty = gDirtyWidgets;
+	bool           takenOver = false;
 
-					center_line = CENTER_LINE_DTMF_DEC;
-					
-					strcpy(String, "DTMF ");
-					strcat(String, gDTMF_RX + idx);
-					UI_PrintStringSmall(String, 2, 0, 3);
-				}
+	if (dirty == 0)
+		return;
+
+	gDirtyWidgets = 0;
+
+	if(gLowBattery && !gLowBatteryConfirmed) {
+		memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+		UI_DisplayPopup("LOW BATTERY");
+		ST7565_BlitFullScreen();
+		gLayoutValid = false;
+		return;
+	}
+
+	if (gEeprom.KEY_LOCK && gKeypadLocked > 0)
+	{	// tell user how to unlock the keyboard
+		memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+		UI_PrintString("Long press #", 0, LCD_WIDTH, 1, 8);
+		UI_PrintString("to unlock",    0, LCD_WIDTH, 3, 8);
+		ST7565_BlitFullScreen();
+		gLayoutValid = false;
+		return;
+	}
+
+	const unsigned int activeTxVFO = gRxVfoIsActive ? gEeprom.RX_VFO : gEeprom.TX_VFO;
+
+	for (unsigned int vfo_num = 0; vfo_num < 2; vfo_num++)
+		takenOver |= IsTakenOver(vfo_num, activeTxVFO);
+
+	// a taken over panel spreads over several widgets and the center line, redraw all of it
+	if (takenOver || !gLayoutValid) {
+		dirty = UI_MAIN_ALL;
+		memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+	}
+	gLayoutValid = !takenOver;
+
+	if (dirty & UI_MAIN_CENTER)
+		center_line = CENTER_LINE_NONE;
+
+	for (unsigned int vfo_num = 0; vfo_num < 2; vfo_num++)
+	{
+		const unsigned int widgets = (dirty >> (vfo_num * UI_MAIN_WIDGETS_PER_VFO)) & UI_MAIN_VFO(0, UI_MAIN_PANEL);
+		Panel_t            panel;
+
+		if (IsTakenOver(vfo_num, activeTxVFO)) {
+			DrawTakenOver(vfo_num, (vfo_num == 0) ? 0 : 4, String);
+			continue;
+		}
+
+		if (widgets == 0)
+			continue;
 
+		GetPanel(&panel, vfo_num, activeTxVFO);
+
+		for (unsigned int widget = 0; widget < UI_MAIN_WIDGETS_PER_VFO; widget++) {
+			if (widgets & (1u << widget)) {
+				ClearWidget(panel.line, widget);
+				gWidgetDraw[widget](vfo_num, &panel, String);
+			}
 		}
-#endif
 	}
 
-	ST7565_BlitFullScreen();
+	if ((dirty & UI_MAIN_CENTER) && center_line == CENTER_LINE_NONE)
+	{	// we're free to use the middle line
+		DrawCenterLine(String);
+	}
+
+	ST7565_BlitDirty();
+}
+
+void UI_DisplayMain(void)
+{
+	gLayoutValid = false;
+	gDirtyWidgets = UI_MAIN_ALL;
+	UI_MAIN_Update();
 }
 
 // ***************************************************************************
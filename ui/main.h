@@ -20,6 +20,8 @@
 #ifndef UI_MAIN_H
 #define UI_MAIN_H
 
+#include <stdint.h>
+
 enum center_line_t {
 	CENTER_LINE_NONE = 0,
 	CENTER_LINE_IN_USE,
@@ -32,9 +34,28 @@ typedef enum center_line_t center_line_t;
 
 extern center_line_t center_line;
 
+// main screen widgets, each VFO panel has one of every kind
+enum {
+	UI_MAIN_CHANNEL         = 1u << 0,   // VFO marker, TX/RX symbol, channel number
+	UI_MAIN_FREQUENCY       = 1u << 1,   // frequency, channel name or VFO state
+	UI_MAIN_LEVEL           = 1u << 2,   // TX power / RX level bars
+	UI_MAIN_FLAGS           = 1u << 3,   // modulation, power, offset, bandwidth ... symbols
+	UI_MAIN_PANEL           = 0x0F,
+	UI_MAIN_WIDGETS_PER_VFO = 4
+};
+
+#define UI_MAIN_VFO(vfo, widgets) ((uint16_t)((widgets) << ((vfo) * UI_MAIN_WIDGETS_PER_VFO)))
+#define UI_MAIN_CENTER            (1u << (2 * UI_MAIN_WIDGETS_PER_VFO))   // S-meter, audio bar, DTMF decoder
+#define UI_MAIN_ALL               (UI_MAIN_VFO(0, UI_MAIN_PANEL) | UI_MAIN_VFO(1, UI_MAIN_PANEL) | UI_MAIN_CENTER)
+
+// what changes when reception starts or stops
+#define UI_MAIN_RX_STATE          (UI_MAIN_VFO(0, UI_MAIN_CHANNEL | UI_MAIN_LEVEL) | UI_MAIN_VFO(1, UI_MAIN_CHANNEL | UI_MAIN_LEVEL) | UI_MAIN_CENTER)
+
 void UI_DisplayAudioBar(void);
 void UI_UpdateRSSI(const int16_t rssi, const int vfo);
 void UI_DisplayMain(void);
+void UI_MAIN_Invalidate(uint16_t Widgets);
+void UI_MAIN_Update(void);
 
 #endif
 
@@ -384,6 +384,9 @@ const t_sidefunction SIDEFUNCTIONS[] =
 	{"VFO/MR",			ACTION_OPT_VFO_MR},
 	{"SWITCH\nDEMODUL",	ACTION_OPT_SWITCH_DEMODUL},
 	{"SWITCH\nBANDWID",	ACTION_OPT_BANDWIDTH},
+#ifdef ENABLE_PROFILER
+	{"PROFILER",		ACTION_OPT_PROFILER},
+#endif
 	//{"SPECTRUM",		ACTION_OPT_SPECTRUM},
 #ifdef ENABLE_BLMIN_TMP_OFF
 	{"BLMIN\nTMP OFF",  ACTION_OPT_BLMIN_TMP_OFF}, 		//BackLight Minimum Temporay OFF
@@ -421,6 +424,98 @@ char    edit_original[17]; // a copy of the text before editing so that we can e
 char    edit[17];
 int     edit_index;
 
+// Option names of the menu items that just show the name of the selected
+// value (or the value itself), looked up by menu id. Items not listed here have
+// their own case in UI_DisplayMenu.
+typedef struct {
+	const void *pNames;  // char[][Stride] table, char * table when Stride is 0
+	uint8_t     Stride;  // NULL names with a stride of 1 print the number
+} MenuNames_t;
+
+#define NAMES(list)     { list, sizeof(list[0]) }
+#define NAME_PTRS(list) { list, 0 }
+#define NUMBER          { NULL, 1 }
+
+static const MenuNames_t gMenuNames[] =
+{
+	[MENU_SQL]          = NUMBER,
+	[MENU_TXP]          = NAMES(gSubMenu_TXP),
+	[MENU_SFT_D]        = NAMES(gSubMenu_SFT_D),
+	[MENU_TOT]          = NAMES(gSubMenu_TOT),
+	[MENU_W_N]          = NAME_PTRS(bwNames),
+	[MENU_BCL]          = NUMBER,
+	[MENU_MDF]          = NAME_PTRS(gSubMenu_MDF),
+	[MENU_SAVE]         = NAMES(gSubMenu_SAVE),
+#ifdef ENABLE_VOX
+	[MENU_VOX_DELAY]    = NAMES(gSubMenu_BACKLIGHT),
+#endif
+	[MENU_ABR]          = NAMES(gSubMenu_BACKLIGHT),
+	[MENU_ABR_ON_TX_RX] = NAMES(gSubMenu_RX_TX),
+	[MENU_TDR]          = NAME_PTRS(gSubMenu_RXMode),
+	[MENU_BEEP]         = NUMBER,
+#ifdef ENABLE_VOICE
+	[MENU_VOICE]        = NAMES(gSubMenu_VOICE),
+#endif
+	[MENU_SC_REV]       = NAMES(gSubMenu_SC_REV),
+	[MENU_S_LIST]       = NUMBER,
+	[MENU_COMPAND]      = NAMES(gSubMenu_RX_TX),
+#ifdef ENABLE_ALARM
+	[MENU_AL_MOD]       = NAMES(gSubMenu_AL_MOD),
+#endif
+	[MENU_PTT_ID]       = NAME_PTRS(gSubMenu_PTT_ID),
+	[MENU_D_ST]         = NAMES(gSubMenu_OFF_ON),
+#ifdef ENABLE_DTMF
+	[MENU_D_RSP]        = NAMES(gSubMenu_D_RSP),
+	[MENU_D_DCD]        = NAMES(gSubMenu_OFF_ON),
+	[MENU_D_LIVE_DEC]   = NAMES(gSubMenu_OFF_ON),
+#endif
+	[MENU_PONMSG]       = NAMES(gSubMenu_PONMSG),
+	[MENU_ROGER]        = NAMES(gSubMenu_ROGER),
+	[MENU_BAT_TXT]      = NAMES(gSubMenu_BAT_TXT),
+	[MENU_AM]           = NAMES(gModulationStr),
+#ifdef ENABLE_NOAA
+	[MENU_NOAA_S]       = NAMES(gSubMenu_OFF_ON),
+#endif
+#ifdef ENABLE_ENCRYPTION
+	[MENU_MSG_ENC]      = NAMES(gSubMenu_OFF_ON),
+#endif
+#ifdef ENABLE_MESSENGER
+	[MENU_MSG_RX]       = NAMES(gSubMenu_OFF_ON),
+	[MENU_MSG_ACK]      = NAMES(gSubMenu_OFF_ON),
+	[MENU_MSG_MODULATION] = NAMES(gSubMenu_MSG_MODULATION),
+#endif
+	[MENU_RESET]        = NAMES(gSubMenu_RESET),
+	[MENU_F_LOCK]       = NAME_PTRS(gSubMenu_F_LOCK),
+	[MENU_SCREN]        = NAMES(gSubMenu_OFF_ON),
+	[MENU_BATTYP]       = NAMES(gSubMenu_BATTYP),
+	[MENU_RX_AGC]       = NAMES(gSubMenu_RX_AGC),
+};
+
+// returns false when the item is not in gMenuNames
+static bool GetOptionName(int menu_id, char *pString)
+{
+	const MenuNames_t *pNames;
+
+	if (menu_id < 0 || menu_id >= (int)ARRAY_SIZE(gMenuNames))
+		return false;
+
+	pNames = &gMenuNames[menu_id];
+
+	if (pNames->pNames == NULL)
+	{
+		if (pNames->Stride == 0)
+			return false;
+		sprintf(pString, "%d", gSubMenuSelection);
+	}
+	else
+	if (pNames->Stride == 0)
+		strcpy(pString, ((const char * const *)pNames->pNames)[gSubMenuSelection]);
+	else
+		strcpy(pString, (const char *)pNames->pNames + (gSubMenuSelection * pNames->Stride));
+
+	return true;
+}
+
 void UI_DisplayMenu(void)
 {
 	unsigned int       i;
@@ -523,13 +618,10 @@ void UI_DisplayMenu(void)
 		already_printed = true;
 	}
 	else
+	if (!GetOptionName(UI_MENU_GetCurrentMenuId(), String))
 	{
 		switch (UI_MENU_GetCurrentMenuId())
 		{
-			case MENU_SQL:
-				sprintf(String, "%d", gSubMenuSelection);
-				break;
-
 			case MENU_MIC:
 				{	// display the mic gain in actual dB rather than just an index number
 					const uint8_t mic = gMicGain_dB2[gSubMenuSelection];
@@ -543,10 +635,6 @@ void UI_DisplayMenu(void)
 				break;
 			}
 
-			case MENU_TXP:
-				strcpy(String, gSubMenu_TXP[gSubMenuSelection]);
-				break;
-
 			case MENU_R_DCS:
 			case MENU_T_DCS:
 				if (gSubMenuSelection == 0)
@@ -571,10 +659,6 @@ void UI_DisplayMenu(void)
 				sprintf(String, "%u.%uHz", CTCSS_Options[gSubMenuSelection] / 10, CTCSS_Options[gSubMenuSelection] % 10);
 				break;
 
-			case MENU_SFT_D:
-				strcpy(String, gSubMenu_SFT_D[gSubMenuSelection]);
-				break;
-
 			case MENU_OFFSET:
 			case MENU_RX_OFFSET:
 				if (!gIsInSubMenu || gInputBoxIndex == 0)
@@ -614,10 +698,6 @@ void UI_DisplayMenu(void)
 					break;
 			#endif
 
-			case MENU_W_N:
-				strcpy(String, bwNames[gSubMenuSelection]);
-				break;
-
 			case MENU_SCR:
 				strcpy(String, gSubMenu_SCRAMBLER[gSubMenuSelection]);
 				#if 1
@@ -635,13 +715,8 @@ void UI_DisplayMenu(void)
 					else
 						sprintf(String, "%d", gSubMenuSelection);
 					break;
-				case MENU_VOX_DELAY:
 			#endif
 
-			case MENU_ABR:
-				strcpy(String, gSubMenu_BACKLIGHT[gSubMenuSelection]);
-				break;
-
 			case MENU_ABR_MIN:
 			case MENU_ABR_MAX:
 				sprintf(String, "%d", gSubMenuSelection);
@@ -649,54 +724,10 @@ void UI_DisplayMenu(void)
 					BACKLIGHT_SetBrightness(gSubMenuSelection);
 				break;	
 
-			case MENU_AM:
-				strcpy(String, gModulationStr[gSubMenuSelection]);
-				break;
-			
-			case MENU_RX_AGC:
-				strcpy(String, gSubMenu_RX_AGC[gSubMenuSelection]);
-				break;
-
 			case MENU_AUTOLK:
 				strcpy(String, (gSubMenuSelection == 0) ? "OFF" : "AUTO");
 				break;
 
-			case MENU_COMPAND:
-			case MENU_ABR_ON_TX_RX:
-				strcpy(String, gSubMenu_RX_TX[gSubMenuSelection]);
-				break;
-
-			case MENU_BCL:
-			case MENU_BEEP:
-			case MENU_S_LIST:
-				sprintf(String, "%d", gSubMenuSelection);
-				break;
-
-			case MENU_D_ST:
-#ifdef ENABLE_DTMF
-			case MENU_D_DCD:
-#endif
-
-#ifdef ENABLE_DTMF
-			case MENU_D_LIVE_DEC:
-#endif
-
-#ifdef ENABLE_NOAA
-				case MENU_NOAA_S:
-#endif
-
-#ifdef ENABLE_ENCRYPTION
-				case MENU_MSG_ENC:
-#endif
-
-#ifdef ENABLE_MESSENGER
-				case MENU_MSG_RX:
-				case MENU_MSG_ACK:
-#endif
-
-			case MENU_SCREN:
-				strcpy(String, gSubMenu_OFF_ON[gSubMenuSelection]);
-				break;
 			case MENU_MEM_CH:
 			case MENU_1_CALL:
 			case MENU_DEL_CH:
@@ -786,43 +817,6 @@ void UI_DisplayMenu(void)
 				}
 			#endif
 
-			#ifdef ENABLE_MESSENGER
-				case MENU_MSG_MODULATION:
-					strcpy(String, gSubMenu_MSG_MODULATION[gSubMenuSelection]);
-					break;
-			#endif
-
-			case MENU_SAVE:
-				strcpy(String, gSubMenu_SAVE[gSubMenuSelection]);
-				break;
-
-			case MENU_TDR:
-				strcpy(String, gSubMenu_RXMode[gSubMenuSelection]);
-				break;
-
-			case MENU_TOT:
-				strcpy(String, gSubMenu_TOT[gSubMenuSelection]);
-				break;
-
-			#ifdef ENABLE_VOICE
-				case MENU_VOICE:
-					strcpy(String, gSubMenu_VOICE[gSubMenuSelection]);
-					break;
-			#endif
-
-			case MENU_SC_REV:
-				strcpy(String, gSubMenu_SC_REV[gSubMenuSelection]);
-				break;
-
-			case MENU_MDF:
-				strcpy(String, gSubMenu_MDF[gSubMenuSelection]);
-				break;
-
-			#ifdef ENABLE_ALARM
-				case MENU_AL_MOD:
-					sprintf(String, gSubMenu_AL_MOD[gSubMenuSelection]);
-					break;
-			#endif
 
 	#ifdef ENABLE_DTMF
 			case MENU_ANI_ID:
@@ -838,10 +832,6 @@ void UI_DisplayMenu(void)
 				break;
 
 	#ifdef ENABLE_DTMF
-			case MENU_D_RSP:
-				strcpy(String, gSubMenu_D_RSP[gSubMenuSelection]);
-				break;
-
 			case MENU_D_HOLD:
 				sprintf(String, "%ds", gSubMenuSelection);
 				break;
@@ -850,14 +840,6 @@ void UI_DisplayMenu(void)
 				sprintf(String, "%d*10ms", gSubMenuSelection);
 				break;
 
-			case MENU_PTT_ID:
-				strcpy(String, gSubMenu_PTT_ID[gSubMenuSelection]);
-				break;
-
-			case MENU_BAT_TXT:
-				strcpy(String, gSubMenu_BAT_TXT[gSubMenuSelection]);
-				break;
-
 	#ifdef ENABLE_DTMF
 			case MENU_D_LIST:
 				gIsDtmfContactValid = DTMF_GetContact((int)gSubMenuSelection - 1, Contact);
@@ -868,14 +850,6 @@ void UI_DisplayMenu(void)
 				break;
 	#endif
 
-			case MENU_PONMSG:
-				strcpy(String, gSubMenu_PONMSG[gSubMenuSelection]);
-				break;
-
-			case MENU_ROGER:
-				strcpy(String, gSubMenu_ROGER[gSubMenuSelection]);
-				break;
-
 			/*case MENU_TEST_RANGE:
 				strcpy(String, gSubMenu_MENU_TEST_RANGE[gSubMenuSelection]);
 				break;*/
@@ -886,14 +860,6 @@ void UI_DisplayMenu(void)
 					BATTERY_VoltsToPercent(gBatteryVoltageAverage));
 				break;
 
-			case MENU_RESET:
-				strcpy(String, gSubMenu_RESET[gSubMenuSelection]);
-				break;
-
-			case MENU_F_LOCK:
-				strcpy(String, gSubMenu_F_LOCK[gSubMenuSelection]);
-				break;
-
 			#ifdef ENABLE_F_CAL_MENU
 				case MENU_F_CALI:
 					{
@@ -916,10 +882,6 @@ void UI_DisplayMenu(void)
 				break;
 			}
 
-			case MENU_BATTYP:
-				strcpy(String, gSubMenu_BATTYP[gSubMenuSelection]);
-				break;	
-
 			case MENU_F1SHRT:
 			case MENU_F1LONG:
 			case MENU_F2SHRT:
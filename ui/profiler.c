@@ -0,0 +1,59 @@
+/* Copyright 2025 Robby69400
+ * https://github.com/Robby69400
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+
+#include "ARMCM0.h"
+#include "driver/st7565.h"
+#include "external/printf/printf.h"
+#include "helper/profiler.h"
+#include "misc.h"
+#include "scheduler.h"
+#include "ui/helper.h"
+#include "ui/profiler.h"
+
+// average and worst time in us, runs over a 10ms tick
+void UI_DisplayProfiler(void)
+{
+	static uint32_t PreviousSleep;
+	static uint32_t PreviousActive;
+	const uint32_t  CyclesPerUs = (SysTick->LOAD + 1) / 10000;
+	uint32_t        Sleep;
+	uint32_t        Active;
+	uint32_t        Total;
+	char            String[32];
+
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+
+	// share of the time awake since the last refresh
+	SCHEDULER_GetCycles(&Sleep, &Active);
+	Total          = (Active - PreviousActive) + (Sleep - PreviousSleep);
+	sprintf(String, "PROFILE LOAD %u%%", (Total >= 100) ? (Active - PreviousActive) / (Total / 100) : 0);
+	PreviousSleep  = Sleep;
+	PreviousActive = Active;
+	GUI_DisplaySmallest(String, 0, 1, false, true);
+
+	for (unsigned int i = 0; i < PROFILER_SECTION_COUNT; i++)
+	{
+		PROFILER_Stats_t Stats;
+
+		PROFILER_Get(i, &Stats);
+		sprintf(String, "%-9s %5u %6u %u", gProfilerSectionNames[i], Stats.Avg / CyclesPerUs, Stats.Max / CyclesPerUs, Stats.Overruns);
+		GUI_DisplaySmallest(String, 0, 8 + (i * 6), false, true);
+	}
+
+	ST7565_BlitFullScreen();
+}
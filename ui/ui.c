@@ -35,6 +35,9 @@
 #include "ui/inputbox.h"
 #include "ui/main.h"
 #include "ui/menu.h"
+#ifdef ENABLE_PROFILER
+	#include "ui/profiler.h"
+#endif
 #include "ui/scanner.h"
 #include "ui/ui.h"
 #ifdef ENABLE_MESSENGER
@@ -82,6 +85,12 @@ void GUI_DisplayScreen(void)
 				break;
 		#endif
 
+		#ifdef ENABLE_PROFILER
+			case DISPLAY_PROFILER:
+				UI_DisplayProfiler();
+				break;
+		#endif
+
 		default:
 			break;
 	}
@@ -33,6 +33,9 @@ enum GUI_DisplayType_t
 	#ifdef ENABLE_MESSENGER
 		DISPLAY_MSG,
 	#endif
+	#ifdef ENABLE_PROFILER
+		DISPLAY_PROFILER,
+	#endif
 	DISPLAY_INVALID = 0xFFu
 };
 
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+
+# Builds the proportional glyph atlas (font_atlas.c) from the fonts in font.c.
+#
+#   font_atlas.py [font.c] > font_atlas.c
+#
+# font.c goes through the host C preprocessor so only the live tables are read.
+# Every glyph keeps the columns from its first to its last lit one, the digits
+# keep the columns any digit uses so numbers still line up in columns. The
+# columns of all glyphs are packed row by row, glyph i of a row is
+# Columns[Row * Stride + Offset[i]] up to Offset[i + 1].
+
+import re
+import subprocess
+import sys
+
+# name in font.c, rows, width of ' ', guard
+FONTS = [
+    ('gFontBig',       2, 4, None),
+    ('gFontSmall',     1, 3, None),
+    ('gFontSmallBold', 1, 3, 'ENABLE_SMALL_BOLD'),
+]
+
+FIRST = ord('!')
+
+def read_tables(path):
+    cc = subprocess.run(['cc', '-E', '-P', '-DENABLE_SMALL_BOLD', '-DENABLE_SPECTRUM', '-I.', path],
+                        check=True, capture_output=True, text=True).stdout
+    tables = {}
+    for m in re.finditer(r'const\s+uint8_t\s+(\w+)\s*\[[^]]*\]\s*\[[^]]*\]\s*=\s*\{(.*?)\};', cc, re.S):
+        glyphs = re.findall(r'\{([^{}]*)\}', m.group(2))
+        tables[m.group(1)] = [[int(v, 0) for v in g.replace(',', ' ').split()] for g in glyphs]
+    return tables
+
+def extent(glyph, rows):
+    width = len(glyph) // rows
+    lit = [c for c in range(width) if any(glyph[r * width + c] for r in range(rows))]
+    return (lit[0], lit[-1] + 1) if lit else (0, 0)
+
+def build(glyphs, rows):
+    width  = len(glyphs[0]) // rows
+    spans  = [extent(g, rows) for g in glyphs]
+    digits = [spans[ord(d) - FIRST] for d in '0123456789']
+    lit    = [s for s in digits if s[1] > s[0]]
+    tabular = (min(s[0] for s in lit), max(s[1] for s in lit))
+    for d in '0123456789':
+        spans[ord(d) - FIRST] = tabular
+
+    offsets = [0]
+    strips  = [[] for _ in range(rows)]
+    for g, (lo, hi) in zip(glyphs, spans):
+        for r in range(rows):
+            strips[r] += g[r * width + lo:r * width + hi]
+        offsets.append(offsets[-1] + hi - lo)
+    return offsets, strips
+
+def hex_lines(values, indent='\t'):
+    out = []
+    for i in range(0, len(values), 16):
+        out.append(indent + ', '.join('0x%02X' % v for v in values[i:i + 16]) + ',')
+    return '\n'.join(out)
+
+def main():
+    tables = read_tables(sys.argv[1] if len(sys.argv) > 1 else 'font.c')
+
+    print('// generated by utils/font_atlas.py from font.c, do not edit')
+    print()
+    print('#include "font.h"')
+    print()
+    print('#ifdef ENABLE_PROPORTIONAL_FONT')
+
+    for name, rows, space, guard in FONTS:
+        offsets, strips = build(tables[name], rows)
+        stride = offsets[-1]
+
+        print()
+        if guard:
+            print('#ifdef %s' % guard)
+        print('static const uint8_t %sColumns[%u * %u] =' % (name, rows, stride))
+        print('{')
+        for r in range(rows):
+            print(hex_lines(strips[r]))
+        print('};')
+        print()
+        print('static const uint16_t %sOffset[%u] =' % (name, len(offsets)))
+        print('{')
+        for i in range(0, len(offsets), 16):
+            print('\t' + ', '.join('%u' % v for v in offsets[i:i + 16]) + ',')
+        print('};')
+        print()
+        print('const FontAtlas_t %sAtlas = { %sColumns, %sOffset, %u, %u };' % (name, name, name, stride, space))
+        if guard:
+            print('#endif')
+
+    print()
+    print('#endif')
+
+main()